@@ -0,0 +1,17 @@
+/****************************************************************************************
+ * driver/i2c.h - Host replacement of the ESP-IDF i2c types
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include "driver/gpio.h"
+
+typedef enum
+{
+    I2C_NUM_0 = 0,
+    I2C_NUM_1,
+    I2C_NUM_MAX
+} i2c_port_t;
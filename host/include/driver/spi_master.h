@@ -0,0 +1,23 @@
+/****************************************************************************************
+ * driver/spi_master.h - Host replacement of the ESP-IDF spi master types
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include "driver/gpio.h"
+
+typedef enum
+{
+    SPI1_HOST = 0,
+    HSPI_HOST = 1,
+    VSPI_HOST = 2
+} spi_host_device_t;
+
+#define SPI_MASTER_FREQ_8M      (80 * 1000 * 1000 / 10)
+#define SPI_MASTER_FREQ_10M     (80 * 1000 * 1000 / 8)
+#define SPI_MASTER_FREQ_20M     (80 * 1000 * 1000 / 4)
+#define SPI_MASTER_FREQ_26M     (80 * 1000 * 1000 / 3)
+#define SPI_MASTER_FREQ_40M     (80 * 1000 * 1000 / 2)
@@ -0,0 +1,12 @@
+/****************************************************************************************
+ * esp_attr.h - Host replacement of the ESP-IDF placement attributes
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
@@ -0,0 +1,8 @@
+/****************************************************************************************
+ * esp_freertos_hooks.h - Host replacement of the ESP-IDF FreeRTOS hooks, nothing is hooked
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
@@ -0,0 +1,21 @@
+/****************************************************************************************
+ * esp_heap_caps.h - Host replacement of the ESP-IDF heap capabilities
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The host heap is checked by the sanitizers, always returns true
+bool heap_caps_check_integrity_all(bool print_errors);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,21 @@
+/****************************************************************************************
+ * esp_timer.h - Host replacement of the ESP-IDF high resolution timer
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ ***************************************************************************************/
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Microseconds since the simulated boot, the start of the host process
+int64_t esp_timer_get_time(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,46 @@
+/****************************************************************************************
+ * DisplayPin.h - Host version of the Smooth display control pin
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <driver/gpio.h>
+
+namespace smooth::application::display
+{
+    class DisplayPin
+    {
+        public:
+            /// Constructor, the pin does nothing on the host
+            DisplayPin(gpio_num_t io, bool pull_up, bool pull_down, bool active_high)
+                    : io(io), pull_up(pull_up), pull_down(pull_down), active_high(active_high)
+            {
+            }
+
+            void set()
+            {
+            }
+
+            void clr()
+            {
+            }
+
+        private:
+            gpio_num_t io;
+            bool pull_up;
+            bool pull_down;
+            bool active_high;
+    };
+}
@@ -0,0 +1,91 @@
+/****************************************************************************************
+ * LCDSpi.h - Host version of the Smooth LCD SPI device, writes to the simulated display
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Same interface as the Smooth LCDSpi, commands and pixel data go to the SimDisplay
+//  frame memory and take the simulated SPI transfer time.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <driver/spi_master.h>
+#include <smooth/core/io/spi/Master.h>
+#include "smooth/application/display/DisplayPin.h"
+
+namespace smooth::application::display
+{
+    struct display_init_cmd_t
+    {
+        uint8_t cmd;
+        uint8_t data[16];
+        uint8_t length;
+    };
+
+    class LCDSpi
+    {
+        public:
+            /// Constructor, the arguments follow the Smooth LCDSpi
+            LCDSpi(std::mutex& guard,
+                   gpio_num_t chip_select,
+                   gpio_num_t data_command,
+                   uint8_t spi_command_bits,
+                   uint8_t spi_address_bits,
+                   uint8_t bits_between_address_and_data_phase,
+                   uint8_t spi_mode,
+                   uint8_t spi_positive_duty_cycle,
+                   uint8_t spi_cs_ena_posttrans,
+                   int spi_clock_speed_hz,
+                   uint32_t spi_device_flags,
+                   int spi_queue_size,
+                   bool use_pre_transaction_callback,
+                   bool use_post_transaction_callback);
+
+            /// Initialize the device
+            bool init(spi_host_device_t host);
+
+            /// Add the reset pin
+            void add_reset_pin(std::unique_ptr<DisplayPin> pin);
+
+            /// Software reset
+            void sw_reset(std::chrono::milliseconds delay_time);
+
+            /// Send the initialization commands
+            bool send_init_cmds(const display_init_cmd_t* init_cmds, size_t length);
+
+            /// Send a command without parameters
+            bool send_cmd(uint8_t cmd);
+
+            /// Send a command with parameters
+            bool send_cmd_with_data(uint8_t cmd, const uint8_t* data, size_t length);
+
+            /// Set the memory data access control
+            bool set_madctl(uint8_t value);
+
+            /// Send pixel data for an address window
+            bool send_lines(int x1, int y1, int x2, int y2, const uint8_t* data, size_t length);
+
+            /// Wait for the pixel data to be sent
+            void wait_for_send_lines_to_finish();
+
+        private:
+            std::mutex& guard;
+            std::unique_ptr<DisplayPin> reset_pin{};
+    };
+}
@@ -0,0 +1,67 @@
+/****************************************************************************************
+ * ST7735.h - Host version of the Smooth ST7735 command definitions
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "smooth/application/display/LCDSpi.h"
+
+namespace smooth::application::display
+{
+    enum LcdCmd : uint8_t
+    {
+        SWRESET = 0x01,
+        SLPOUT = 0x11,
+        NORON = 0x13,
+        INVOFF = 0x20,
+        INVON = 0x21,
+        DISPON = 0x29,
+        CASET = 0x2A,
+        RASET = 0x2B,
+        RAMWR = 0x2C,
+        MADCTL = 0x36,
+        COLMOD = 0x3A
+    };
+
+    struct DisplayOffsets
+    {
+        int col_offset;
+        int row_offset;
+    };
+
+    // The M5StickC 80x160 panel sits at column 26, row 1 of the 132x162 frame memory
+    static constexpr DisplayOffsets offsets_green_tab_160x80 = { 26, 1 };
+
+    // The host only needs the commands that change how the frame memory is written
+    static constexpr std::array<display_init_cmd_t, 2> init_cmds_R_part1 =
+    { {
+        { SLPOUT, { 0 }, 0 },
+        { COLMOD, { 0x05 }, 1 }                 // 16 bit color
+    } };
+
+    static constexpr std::array<display_init_cmd_t, 2> init_cmds_R_grn_tab_part2 =
+    { {
+        { CASET, { 0x00, 0x00, 0x00, 0x7F }, 4 },
+        { RASET, { 0x00, 0x00, 0x00, 0x9F }, 4 }
+    } };
+
+    static constexpr std::array<display_init_cmd_t, 2> init_cmds_R_part3 =
+    { {
+        { NORON, { 0 }, 0 },
+        { DISPON, { 0 }, 0 }
+    } };
+}
@@ -0,0 +1,64 @@
+/****************************************************************************************
+ * AxpPMU.h - Host version of the Smooth AXP192 driver
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <smooth/core/io/i2c/I2CMasterDevice.h>
+#include "smooth/application/io/i2c/AxpRegisters.h"
+
+namespace smooth::application::sensor
+{
+    class AxpPMU : public core::io::i2c::I2CMasterDevice
+    {
+        public:
+            /// Constructor
+            AxpPMU(i2c_port_t port, uint8_t address, std::mutex& guard);
+
+            /// Write the initialization registers
+            bool write_init_regs(const AxpInitReg* init_regs, size_t length);
+
+            /// Read-modify-write a group of bits of a register
+            /// \param reg The register
+            /// \param mask The mask of the group, not shifted
+            /// \param shift The position of the group
+            /// \param value The new value of the group
+            bool write_register_bits(AxpRegister reg, uint8_t mask, uint8_t shift, uint8_t value);
+
+            /// The measurements, each read in its own transaction, in V, mA, C, mW and mAh
+            bool get_acin_voltage(float& voltage);
+            bool get_acin_current(float& current);
+            bool get_vbus_voltage(float& voltage);
+            bool get_vbus_current(float& current);
+            bool get_axp_device_temperature(float& temperature);
+            bool get_ts_voltage(float& voltage);
+            bool get_battery_power(float& power);
+            bool get_battery_voltage(float& voltage);
+            bool get_battery_charging_current(float& current);
+            bool get_battery_discharging_current(float& current);
+            bool get_aps_voltage(float& voltage);
+            bool get_battery_capacity(float& capacity);
+
+        private:
+            /// Read a 12 bit ADC register group and scale it
+            bool read_bits12(AxpRegister reg, float lsb, float& value);
+
+            /// Read a 13 bit ADC register group and scale it
+            bool read_bits13(AxpRegister reg, float lsb, float& value);
+
+            /// Combine the 4 registers of a coulomb counter
+            static uint32_t to_bits32(const uint8_t* data);
+    };
+}
@@ -0,0 +1,59 @@
+/****************************************************************************************
+ * AxpRegisters.h - Host version of the Smooth AXP192 register definitions
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+namespace smooth::application::sensor
+{
+    enum class AxpRegister : uint8_t
+    {
+        Reg12H_Power_Out_Ctrl = 0x12,
+        Reg28H_Ldo2_Ldo3_VSet = 0x28,
+        Reg30H_Ips_Out_Mngmnt = 0x30,
+        Reg32H_Shutdn_ChrgLed = 0x32,
+        Reg33H_Chrg_Control_1 = 0x33,
+        Reg34H_Chrg_Control_2 = 0x34,
+        Reg35H_Backup_Chrg_Ctl = 0x35,
+        Reg36H_PEK_Key_Setting = 0x36,
+        Reg39H_Vhth_Chrg_Set = 0x39,
+        Reg56H_Acin_Volt_Adc = 0x56,
+        Reg58H_Acin_Curr_Adc = 0x58,
+        Reg5AH_Vbus_Volt_Adc = 0x5A,
+        Reg5CH_Vbus_Curr_Adc = 0x5C,
+        Reg5EH_Axp_Temp_Adc = 0x5E,
+        Reg62H_Ts_Input_Adc = 0x62,
+        Reg70H_Batt_Power = 0x70,
+        Reg78H_Batt_Volt_Adc = 0x78,
+        Reg7AH_Batt_Chrg_Curr_Adc = 0x7A,
+        Reg7CH_Batt_Dischrg_Curr_Adc = 0x7C,
+        Reg7EH_Aps_Volt_Adc = 0x7E,
+        Reg82H_Adc_Enable_1 = 0x82,
+        Reg84H_Adc_Sample_Rate = 0x84,
+        Reg90H_Gpio0_Func_Set = 0x90,
+        Reg91H_Gpio0_Volt_Set = 0x91,
+        RegB0H_Batt_Chrg_Coulomb = 0xB0,
+        RegB4H_Batt_Dischrg_Coulomb = 0xB4,
+        RegB8H_Coulomb_Counter_Ctrl = 0xB8
+    };
+
+    struct AxpInitReg
+    {
+        AxpRegister reg;
+        uint8_t data;
+    };
+}
@@ -0,0 +1,55 @@
+/****************************************************************************************
+ * BME280.h - Host version of the Smooth BME280 driver, used for the BMP280
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <smooth/core/io/i2c/I2CMasterDevice.h>
+#include "smooth/application/io/i2c/BME280Core.h"
+
+namespace smooth::application::sensor
+{
+    class BME280 : public core::io::i2c::I2CMasterDevice, public BME280Core
+    {
+        public:
+            /// Constructor
+            BME280(i2c_port_t port, uint8_t address, std::mutex& guard);
+
+            /// Soft reset the sensor
+            bool reset();
+
+            /// Read the measuring and NVM copy status bits
+            bool read_status(bool& measuring, bool& im_update);
+
+            /// Write the mode, oversampling, standby time and filter
+            bool configure_sensor(SensorMode mode,
+                                  OverSampling humidity,
+                                  OverSampling pressure,
+                                  OverSampling temperature,
+                                  StandbyTimeMS standby,
+                                  FilterCoeff filter);
+
+            /// Read the measurements, the humidity is always 0 on a BMP280
+            /// \param humidity The humidity in %RH
+            /// \param pressure The pressure in hPa
+            /// \param temperature The temperature in degree celsius
+            bool read_measurements(float& humidity, float& pressure, float& temperature);
+
+        private:
+            std::array<uint8_t, 24> trimming{};
+            bool trimming_read{ false };
+    };
+}
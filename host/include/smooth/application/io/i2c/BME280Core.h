@@ -0,0 +1,64 @@
+/****************************************************************************************
+ * BME280Core.h - Host version of the Smooth BME280 settings
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+namespace smooth::application::sensor
+{
+    class BME280Core
+    {
+        public:
+            enum class SensorMode : uint8_t
+            {
+                Sleep = 0x00,
+                Forced = 0x01,
+                Normal = 0x03
+            };
+
+            enum class OverSampling : uint8_t
+            {
+                Skipped = 0x00,
+                Oversamplingx1,
+                Oversamplingx2,
+                Oversamplingx4,
+                Oversamplingx8,
+                Oversamplingx16
+            };
+
+            enum class StandbyTimeMS : uint8_t
+            {
+                ST_0_5 = 0x00,
+                ST_62_5,
+                ST_125,
+                ST_250,
+                ST_500,
+                ST_1000,
+                ST_10,
+                ST_20
+            };
+
+            enum class FilterCoeff : uint8_t
+            {
+                FC_OFF = 0x00,
+                FC_2,
+                FC_4,
+                FC_8,
+                FC_16
+            };
+    };
+}
@@ -0,0 +1,32 @@
+/****************************************************************************************
+ * DHT12.h - Host version of the Smooth DHT12 driver
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <smooth/core/io/i2c/I2CMasterDevice.h>
+
+namespace smooth::application::sensor
+{
+    class DHT12 : public core::io::i2c::I2CMasterDevice
+    {
+        public:
+            /// Constructor
+            DHT12(i2c_port_t port, uint8_t address, std::mutex& guard);
+
+            /// Read the humidity in %RH and the temperature in degree celsius
+            bool read_measurements(float& humidity, float& temperature);
+    };
+}
@@ -0,0 +1,97 @@
+/****************************************************************************************
+ * PCF8563.h - Host version of the Smooth PCF8563 real time clock driver
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <string>
+#include <smooth/core/io/i2c/I2CMasterDevice.h>
+
+namespace smooth::application::sensor
+{
+    class PCF8563 : public core::io::i2c::I2CMasterDevice
+    {
+        public:
+            enum class DayOfWeek : uint8_t
+            {
+                Sunday = 0,
+                Monday,
+                Tuesday,
+                Wednesday,
+                Thursday,
+                Friday,
+                Saturday
+            };
+
+            enum class Month : uint8_t
+            {
+                January = 1,
+                February,
+                March,
+                April,
+                May,
+                June,
+                July,
+                August,
+                September,
+                October,
+                November,
+                December
+            };
+
+            static constexpr std::array<const char*, 7> DayOfWeekStrings =
+            { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+
+            static constexpr std::array<const char*, 13> MonthStrings =
+            { "", "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+            struct RtcTime
+            {
+                uint8_t seconds;
+                uint8_t minutes;
+                uint8_t hours24;
+                uint8_t days;
+                DayOfWeek weekdays;
+                Month months;
+                uint16_t years;
+            };
+
+            struct AlarmTime
+            {
+                uint8_t minute;
+                uint8_t hour24;
+                uint8_t day;
+                DayOfWeek weekday;
+                bool ena_alrm_minute;
+                bool ena_alrm_hour;
+                bool ena_alrm_day;
+                bool ena_alrm_weekday;
+            };
+
+            /// Constructor
+            PCF8563(i2c_port_t port, uint8_t address, std::mutex& guard);
+
+            bool set_rtc_time(const RtcTime& time);
+            bool get_rtc_time(RtcTime& time);
+            bool set_alarm_time(const AlarmTime& time);
+            bool get_alarm_time(AlarmTime& time);
+            bool is_alarm_flag_active(bool& active);
+            bool clear_alarm_flag();
+
+            /// Format a time as "1:08:00 PM"
+            std::string get_12hr_time_string(uint8_t hours24, uint8_t minutes, uint8_t seconds);
+    };
+}
@@ -0,0 +1,38 @@
+/****************************************************************************************
+ * Input.h - Host version of the Smooth gpio input, reads the simulated buttons
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <driver/gpio.h>
+
+namespace smooth::core::io
+{
+    class Input
+    {
+        public:
+            /// Constructor
+            /// \param io The gpio
+            /// \param pull_up Unused on the host
+            /// \param pull_down Unused on the host
+            Input(gpio_num_t io, bool pull_up = true, bool pull_down = false);
+
+            /// Read the level of the input
+            bool read() const;
+
+        private:
+            gpio_num_t io;
+    };
+}
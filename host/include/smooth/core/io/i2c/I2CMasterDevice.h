@@ -0,0 +1,61 @@
+/****************************************************************************************
+ * I2CMasterDevice.h - Host version of the Smooth I2C master device, talks to the simulated bus
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Same interface as the Smooth I2CMasterDevice, the transactions are performed on the
+//  SimI2cBus of the port instead of the ESP-IDF i2c driver.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <driver/i2c.h>
+#include <smooth/core/util/FixedBuffer.h>
+
+namespace smooth::core::io::i2c
+{
+    class I2CMasterDevice
+    {
+        public:
+            /// Constructor
+            /// \param port The I2C port
+            /// \param address The I2C address of the device
+            /// \param guard The I2C bus mutex
+            I2CMasterDevice(i2c_port_t port, uint8_t address, std::mutex& guard);
+
+            virtual ~I2CMasterDevice() = default;
+
+            /// Is the device answering on the bus
+            bool is_present() const;
+
+        protected:
+            /// Write data, the first byte is the register address
+            bool write(uint8_t address, std::vector<uint8_t>& data, bool expect_ack = true);
+
+            /// Read registers with a repeated start
+            bool read(uint8_t address, uint8_t slave_register, core::util::FixedBufferBase<uint8_t>& data,
+                      bool use_restart_signal = true, bool end_with_nack = true);
+
+            /// Read registers into a plain buffer
+            bool read(uint8_t address, uint8_t slave_register, uint8_t* data, size_t length);
+
+            i2c_port_t port;
+            uint8_t address;
+            std::mutex& guard;
+    };
+}
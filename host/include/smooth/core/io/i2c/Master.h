@@ -0,0 +1,51 @@
+/****************************************************************************************
+ * Master.h - Host version of the Smooth I2C master
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <driver/i2c.h>
+#include "smooth/core/io/i2c/I2CMasterDevice.h"
+
+namespace smooth::core::io::i2c
+{
+    class Master
+    {
+        public:
+            /// Constructor
+            /// \param port The I2C port
+            /// \param scl The SCL pin, unused on the host
+            /// \param scl_internal_pullup_enable Unused on the host
+            /// \param sda The SDA pin, unused on the host
+            /// \param sda_internal_pullup_enable Unused on the host
+            /// \param clock_frequency The clock frequency of the simulated bus
+            Master(i2c_port_t port, gpio_num_t scl, bool scl_internal_pullup_enable,
+                   gpio_num_t sda, bool sda_internal_pullup_enable, int clock_frequency);
+
+            /// Create a device on the bus
+            /// \param args The arguments of the device after the port, usually the address
+            template<typename DeviceType, typename... Args>
+            std::unique_ptr<DeviceType> create_device(Args&& ... args)
+            {
+                return std::make_unique<DeviceType>(port, std::forward<Args>(args)..., guard);
+            }
+
+        private:
+            i2c_port_t port;
+            std::mutex guard{};
+    };
+}
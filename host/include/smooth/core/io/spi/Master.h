@@ -0,0 +1,55 @@
+/****************************************************************************************
+ * Master.h - Host version of the Smooth SPI master
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <driver/spi_master.h>
+
+namespace smooth::core::io::spi
+{
+    enum class SPI_DMA_Channel : int
+    {
+        DMA_0 = 0,
+        DMA_1,
+        DMA_2
+    };
+
+    class Master
+    {
+        public:
+            /// Initialize the SPI host, nothing to do on the host
+            static bool initialize(spi_host_device_t host,
+                                   SPI_DMA_Channel dma_channel,
+                                   gpio_num_t mosi,
+                                   gpio_num_t miso,
+                                   gpio_num_t clock,
+                                   int transfer_size,
+                                   gpio_num_t quadwp_io_num = GPIO_NUM_NC,
+                                   gpio_num_t quadhd_io_num = GPIO_NUM_NC);
+
+            /// Create a device on the bus
+            template<typename DeviceType, typename... Args>
+            static std::unique_ptr<DeviceType> create_device(Args&& ... args)
+            {
+                return std::make_unique<DeviceType>(guard, std::forward<Args>(args)...);
+            }
+
+        private:
+            static std::mutex guard;
+    };
+}
@@ -0,0 +1,48 @@
+/****************************************************************************************
+ * SpiDmaFixedBuffer.h - Host version of the Smooth DMA capable buffer
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <vector>
+
+namespace smooth::core::io::spi
+{
+    template<typename T, int Size>
+    class SpiDmaFixedBuffer
+    {
+        public:
+            /// Is the buffer allocated, always on the host
+            bool is_buffer_allocated() const
+            {
+                return !buffer.empty();
+            }
+
+            /// Get the buffer
+            T* data()
+            {
+                return buffer.data();
+            }
+
+            /// Get the size of the buffer
+            int size() const
+            {
+                return Size;
+            }
+
+        private:
+            std::vector<T> buffer = std::vector<T>(Size);
+    };
+}
@@ -0,0 +1,215 @@
+/****************************************************************************************
+ * main.cpp - The entry point of the host (Linux) build
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Runs the unchanged App against the simulated peripherals.
+//
+//      --sim <device>.<parameter>=<value>  set a device model parameter, see
+//                                          sim/SimI2cDevice.h and the device models
+//      --press <gpio>@<ms>[:<hold ms>]     press a button (39 next, 37 prev) at a time
+//                                          after boot, held 100ms by default
+//      --run-seconds <n>                   exit after n seconds, for CI
+//      --screenshot <file.ppm>             write the 160x80 screen when exiting
+//      --timeline <file.json>              record the timeline of the tasks and write it
+//                                          as a Chrome trace when exiting, see
+//                                          model/Timeline.h
+//      --replay <trace>                    show a recorded sensor trace instead of
+//                                          reading the simulated sensors, see
+//                                          replay/ReplayApp.h
+//      --speed <n>                         replay at n times real time, 1 by default
+//      --bench                             run the benchmarks of model/EnvirBenchmark.h
+//                                          and model/SampleStoreBenchmark.h and exit
+//
+//  Examples:
+//      M5StickColorEnvirSensor --sim dht12.latency_us=1500 --sim bmp280.fail_next=3
+//          --press 39@3000 --run-seconds 10 --screenshot view.ppm
+//      M5StickColorEnvirSensor --run-seconds 5 --timeline trace.json
+//      M5StickColorEnvirSensor --replay console.log --speed 60
+/////////////////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <smooth/application/display/ST7735.h>
+#include "App.h"
+#include "model/EnvirBenchmark.h"
+#include "model/SampleStoreBenchmark.h"
+#include "model/Timeline.h"
+#include "replay/ReplayApp.h"
+#include "replay/TraceFile.h"
+#include "sim/SimButtons.h"
+#include "sim/SimDisplay.h"
+#include "sim/Simulation.h"
+
+using namespace redstone;
+using namespace std::chrono;
+
+namespace
+{
+    constexpr int SCREEN_WIDTH = 160;
+    constexpr int SCREEN_HEIGHT = 80;
+
+    void print_usage(const char* program)
+    {
+        std::cout << "usage: " << program
+                  << " [--sim <device>.<parameter>=<value>]... [--press <gpio>@<ms>[:<hold ms>]]..."
+                  << " [--run-seconds <n>] [--screenshot <file.ppm>] [--timeline <file.json>] [--replay <trace> [--speed <n>]] [--bench]" << std::endl;
+    }
+
+    bool parse_press(const std::string& text)
+    {
+        int gpio = 0;
+        long at_ms = 0;
+        long hold_ms = 100;
+        int fields = std::sscanf(text.c_str(), "%d@%ld:%ld", &gpio, &at_ms, &hold_ms);
+
+        if (fields >= 2 && gpio >= 0 && gpio < GPIO_NUM_MAX)
+        {
+            SimButtons::instance().press(static_cast<gpio_num_t>(gpio), at_ms, hold_ms);
+        }
+
+        return fields >= 2;
+    }
+
+    // Let the application run for a while then save the screen and the timeline and
+    // exit, the Application task never returns by itself
+    void exit_after(int run_seconds, std::string screenshot, std::string timeline)
+    {
+        std::this_thread::sleep_for(seconds(run_seconds));
+
+        if (!screenshot.empty())
+        {
+            // landscape, the rows and columns of the offsets are swapped by MADCTL
+            auto& offsets = smooth::application::display::offsets_green_tab_160x80;
+            SimDisplay::instance().write_ppm(screenshot, offsets.row_offset, offsets.col_offset,
+                                             SCREEN_WIDTH, SCREEN_HEIGHT);
+        }
+
+        if (!timeline.empty())
+        {
+            std::ofstream file(timeline);
+            Timeline::instance().write(file);
+        }
+
+        Simulation::instance().print_statistics();
+        std::fflush(stdout);
+        std::_Exit(EXIT_SUCCESS);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int run_seconds = 0;
+    std::string screenshot{};
+    std::string timeline{};
+    std::string replay{};
+    float speed = 1.0f;
+    bool res = true;
+
+    for (int i = 1; i < argc && res; i++)
+    {
+        bool has_value = i + 1 < argc;
+
+        if (std::strcmp(argv[i], "--sim") == 0 && has_value)
+        {
+            res = Simulation::instance().set_parameter(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--press") == 0 && has_value)
+        {
+            res = parse_press(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--run-seconds") == 0 && has_value)
+        {
+            run_seconds = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--screenshot") == 0 && has_value)
+        {
+            screenshot = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--timeline") == 0 && has_value)
+        {
+            timeline = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--bench") == 0)
+        {
+            EnvirBenchmark::run();
+            SampleStoreBenchmark::run();
+
+            return EXIT_SUCCESS;
+        }
+        else if (std::strcmp(argv[i], "--replay") == 0 && has_value)
+        {
+            replay = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--speed") == 0 && has_value)
+        {
+            speed = std::strtof(argv[++i], nullptr);
+            res = speed > 0.0f;
+        }
+        else
+        {
+            res = false;
+        }
+    }
+
+    if (!res)
+    {
+        print_usage(argv[0]);
+
+        return EXIT_FAILURE;
+    }
+
+    // attach the device models before the application creates its devices
+    Simulation::instance();
+
+    if (!timeline.empty())
+    {
+        Timeline::instance().start();
+    }
+
+    if (run_seconds > 0)
+    {
+        std::thread(exit_after, run_seconds, screenshot, timeline).detach();
+    }
+
+    if (!replay.empty())
+    {
+        std::vector<uint8_t> trace{};
+
+        if (!TraceFile::load(replay, trace))
+        {
+            std::cout << "no sensor trace in " << replay << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        ReplayApp replay_app(std::move(trace), speed);
+        replay_app.start();
+    }
+    else
+    {
+        App app;
+        app.start();
+    }
+
+    return EXIT_SUCCESS;
+}
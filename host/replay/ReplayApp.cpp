@@ -0,0 +1,119 @@
+/****************************************************************************************
+ * ReplayApp.cpp - Replays a recorded sensor trace through the GUI of the host build
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "replay/ReplayApp.h"
+#include <cstdlib>
+#include <esp_timer.h>
+#include <smooth/core/task_priorities.h>
+#include <smooth/core/logging/log.h>
+#include "model/ConflatingMailbox.h"
+#include "model/LatencyProbe.h"
+
+using namespace smooth::core;
+using namespace smooth::core::ipc;
+using namespace smooth::core::logging;
+using namespace std::chrono;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "ReplayApp";
+    static constexpr int64_t RENDER_WAIT_US = 500 * 1000;     // time for the last values to be shown
+
+    // Constructor
+    ReplayApp::ReplayApp(std::vector<uint8_t> trace, float speed) :
+            Application(APPLICATION_BASE_PRIO, milliseconds(1)),
+            trace(std::move(trace)),
+            speed(speed),
+            reader(this->trace.data(), this->trace.size())
+    {
+    }
+
+    // Initialize the application
+    void ReplayApp::init()
+    {
+        Log::warning(TAG, "============ Replaying {} bytes of sensor trace at {}x ===========", trace.size(), speed);
+        Application::init();
+        lvgl_task.start();
+        hw_btn_task.start();
+
+        has_record = reader.next(record);
+        first_record_ms = record.time_ms;
+        start_us = esp_timer_get_time();
+        finished_us = has_record ? -1 : start_us;
+    }
+
+    // Publish the values that are due at the replay time
+    void ReplayApp::tick()
+    {
+        int64_t now_us = esp_timer_get_time();
+        auto replay_ms = static_cast<int64_t>((now_us - start_us) * speed / 1000);
+        bool is_due = false;
+
+        while (has_record && record.time_ms - first_record_ms <= replay_ms)
+        {
+            if (record.type == SensorTraceRecordType::Envir)
+            {
+                record.envir_value.set_sequence(++envir_sequence);
+                record.envir_value.set_timestamp_us(esp_timer_get_time());
+                frame.set_envir_value(record.envir_value);
+                frame.set_valid_fields(frame.get_valid_fields() | SensorFrame::DHT12_FIELDS
+                                       | SensorFrame::BMP280_FIELDS);
+            }
+            else
+            {
+                record.axp_value.set_sequence(++axp_sequence);
+                record.axp_value.set_timestamp_us(esp_timer_get_time());
+                frame.set_axp_value(record.axp_value);
+                frame.set_valid_fields(frame.get_valid_fields() | SensorFrame::AXP192_FIELDS);
+            }
+
+            is_due = true;
+            has_record = reader.next(record);
+
+            if (!has_record)
+            {
+                finished_us = now_us;
+            }
+        }
+
+        if (is_due)
+        {
+            frame.set_sequence(frame.get_sequence() + 1);
+            frame.set_timestamp_us(esp_timer_get_time());
+            ConflatingMailbox<SensorFrame>::publish(frame);
+        }
+
+        if (finished_us >= 0 && now_us - finished_us > RENDER_WAIT_US)
+        {
+            finish();
+        }
+    }
+
+    // Log the replay statistics and exit, the Application task never returns by itself
+    void ReplayApp::finish()
+    {
+        float elapsed_s = (finished_us - start_us) / 1000000.0f;
+
+        Log::info(TAG, "Replayed {} EnvirValue and {} AxpValue in {} frames in {:.1f} s",
+                  envir_sequence, axp_sequence, frame.get_sequence(), elapsed_s);
+        LatencyProbe::instance().print_statistics();
+        Log::info(TAG, "Dropped events = {}", LatencyProbe::instance().get_dropped());
+
+        std::fflush(stdout);
+        std::_Exit(EXIT_SUCCESS);
+    }
+}
@@ -0,0 +1,71 @@
+/****************************************************************************************
+ * ReplayApp.h - Replays a recorded sensor trace through the GUI of the host build
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Instead of reading the sensors the recorded values are published in SensorFrames, at
+//  the recorded times divided by the speed-up, to the unchanged LvglTask and its content
+//  panes.  The values due in a tick update the frame and it is published once, with a
+//  new sequence number and the time it is published, so the LatencyProbe measures the
+//  publish to render latency and the drops of the replay.
+//
+//  The trace is loaded by TraceFile.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <smooth/core/Application.h>
+#include "gui/LvglTask.h"
+#include "button/HwBtnTask.h"
+#include "model/SensorFrame.h"
+#include "model/SensorTrace.h"
+
+namespace redstone
+{
+    class ReplayApp : public smooth::core::Application
+    {
+        public:
+            /// Constructor
+            /// \param trace The trace data
+            /// \param speed The speed-up of the replay, 1 is real time
+            ReplayApp(std::vector<uint8_t> trace, float speed);
+
+            void init() override;
+
+            /// Publish the values that are due
+            void tick() override;
+
+        private:
+            /// Log the replay statistics and exit
+            void finish();
+
+            std::vector<uint8_t> trace;
+            float speed;
+            SensorTraceReader reader;
+            SensorTraceRecord record{};
+            bool has_record{ false };
+            int64_t start_us{ 0 };
+            int64_t first_record_ms{ 0 };
+            int64_t finished_us{ -1 };
+            uint32_t envir_sequence{ 0 };
+            uint32_t axp_sequence{ 0 };
+            SensorFrame frame{};
+
+            LvglTask lvgl_task{};
+            HwBtnTask hw_btn_task{};
+    };
+}
@@ -0,0 +1,65 @@
+/****************************************************************************************
+ * TraceFile.cpp - Loads a sensor trace from a file
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "replay/TraceFile.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+namespace redstone
+{
+    // Class constants
+    static const char* TRACE_MARKER = "TRACE ";
+
+    // Load a trace, the hex lines of a console log or the binary trace data
+    bool TraceFile::load(const std::string& path, std::vector<uint8_t>& trace)
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        if (content.find(TRACE_MARKER) != std::string::npos)
+        {
+            std::istringstream lines(content);
+            std::string line;
+
+            while (std::getline(lines, line))
+            {
+                auto marker = line.find(TRACE_MARKER);
+                size_t start = marker == std::string::npos ? line.size() : marker + std::strlen(TRACE_MARKER);
+
+                for (size_t i = start; i + 1 < line.size(); i += 2)
+                {
+                    unsigned int byte = 0;
+
+                    if (std::sscanf(line.c_str() + i, "%2x", &byte) != 1)
+                    {
+                        break;
+                    }
+
+                    trace.push_back(static_cast<uint8_t>(byte));
+                }
+            }
+        }
+        else
+        {
+            trace.assign(content.begin(), content.end());
+        }
+
+        return !trace.empty();
+    }
+}
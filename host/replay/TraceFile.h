@@ -0,0 +1,39 @@
+/****************************************************************************************
+ * TraceFile.h - Loads a sensor trace from a file
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The trace is either the binary trace data or a console log holding the
+//  "TRACE <hex>" lines of SensorTask dumps.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace redstone
+{
+    class TraceFile
+    {
+        public:
+            /// Load a trace
+            /// \param path The trace file, binary or a console log
+            /// \param trace The trace data loaded
+            /// \return true on success, false if the file can't be read or holds no trace
+            static bool load(const std::string& path, std::vector<uint8_t>& trace);
+    };
+}
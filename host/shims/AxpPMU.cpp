@@ -0,0 +1,175 @@
+/****************************************************************************************
+ * AxpPMU.cpp - Host version of the Smooth AXP192 driver
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <smooth/application/io/i2c/AxpPMU.h>
+
+namespace smooth::application::sensor
+{
+    // ADC sample rate set in Reg84H_Adc_Sample_Rate by the firmware
+    static constexpr float ADC_SAMPLE_RATE_HZ = 200.0f;
+
+    // Constructor
+    AxpPMU::AxpPMU(i2c_port_t port, uint8_t address, std::mutex& guard) : I2CMasterDevice(port, address, guard)
+    {
+    }
+
+    // Write the initialization registers, one transaction per register
+    bool AxpPMU::write_init_regs(const AxpInitReg* init_regs, size_t length)
+    {
+        bool res = true;
+
+        for (size_t i = 0; i < length && res; i++)
+        {
+            std::vector<uint8_t> data{ static_cast<uint8_t>(init_regs[i].reg), init_regs[i].data };
+            res = write(address, data);
+        }
+
+        return res;
+    }
+
+    // Read-modify-write a group of bits of a register
+    bool AxpPMU::write_register_bits(AxpRegister reg, uint8_t mask, uint8_t shift, uint8_t value)
+    {
+        uint8_t current;
+        bool res = read(address, static_cast<uint8_t>(reg), &current, 1);
+
+        if (res)
+        {
+            auto updated = static_cast<uint8_t>((current & ~(mask << shift)) | ((value & mask) << shift));
+            std::vector<uint8_t> data{ static_cast<uint8_t>(reg), updated };
+            res = write(address, data);
+        }
+
+        return res;
+    }
+
+    bool AxpPMU::get_acin_voltage(float& voltage)
+    {
+        bool res = read_bits12(AxpRegister::Reg56H_Acin_Volt_Adc, 1.7f, voltage);
+        voltage /= 1000.0f;
+
+        return res;
+    }
+
+    bool AxpPMU::get_acin_current(float& current)
+    {
+        return read_bits12(AxpRegister::Reg58H_Acin_Curr_Adc, 0.625f, current);
+    }
+
+    bool AxpPMU::get_vbus_voltage(float& voltage)
+    {
+        bool res = read_bits12(AxpRegister::Reg5AH_Vbus_Volt_Adc, 1.7f, voltage);
+        voltage /= 1000.0f;
+
+        return res;
+    }
+
+    bool AxpPMU::get_vbus_current(float& current)
+    {
+        return read_bits12(AxpRegister::Reg5CH_Vbus_Curr_Adc, 0.375f, current);
+    }
+
+    bool AxpPMU::get_axp_device_temperature(float& temperature)
+    {
+        bool res = read_bits12(AxpRegister::Reg5EH_Axp_Temp_Adc, 0.1f, temperature);
+        temperature -= 144.7f;
+
+        return res;
+    }
+
+    bool AxpPMU::get_ts_voltage(float& voltage)
+    {
+        bool res = read_bits12(AxpRegister::Reg62H_Ts_Input_Adc, 0.8f, voltage);
+        voltage /= 1000.0f;
+
+        return res;
+    }
+
+    bool AxpPMU::get_battery_power(float& power)
+    {
+        uint8_t data[3] = { 0, 0, 0 };
+        bool res = read(address, static_cast<uint8_t>(AxpRegister::Reg70H_Batt_Power), data, sizeof(data));
+        power = static_cast<float>((data[0] << 16) | (data[1] << 8) | data[2]) * 1.1f * 0.5f / 1000.0f;
+
+        return res;
+    }
+
+    bool AxpPMU::get_battery_voltage(float& voltage)
+    {
+        bool res = read_bits12(AxpRegister::Reg78H_Batt_Volt_Adc, 1.1f, voltage);
+        voltage /= 1000.0f;
+
+        return res;
+    }
+
+    bool AxpPMU::get_battery_charging_current(float& current)
+    {
+        return read_bits13(AxpRegister::Reg7AH_Batt_Chrg_Curr_Adc, 0.5f, current);
+    }
+
+    bool AxpPMU::get_battery_discharging_current(float& current)
+    {
+        return read_bits13(AxpRegister::Reg7CH_Batt_Dischrg_Curr_Adc, 0.5f, current);
+    }
+
+    bool AxpPMU::get_aps_voltage(float& voltage)
+    {
+        bool res = read_bits12(AxpRegister::Reg7EH_Aps_Volt_Adc, 1.4f, voltage);
+        voltage /= 1000.0f;
+
+        return res;
+    }
+
+    // Both coulomb counters are read in one transaction, the discharge counter follows at 0xB4
+    bool AxpPMU::get_battery_capacity(float& capacity)
+    {
+        uint8_t data[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+        bool res = read(address, static_cast<uint8_t>(AxpRegister::RegB0H_Batt_Chrg_Coulomb), data, sizeof(data));
+        uint32_t charge = to_bits32(&data[0]);
+        uint32_t discharge = to_bits32(&data[4]);
+
+        auto delta = static_cast<float>(static_cast<int32_t>(charge - discharge));
+        capacity = 65536.0f * 0.5f * delta / 3600.0f / ADC_SAMPLE_RATE_HZ;
+
+        return res;
+    }
+
+    // Read a 12 bit ADC register group and scale it
+    bool AxpPMU::read_bits12(AxpRegister reg, float lsb, float& value)
+    {
+        uint8_t data[2] = { 0, 0 };
+        bool res = read(address, static_cast<uint8_t>(reg), data, sizeof(data));
+        value = static_cast<float>((data[0] << 4) | (data[1] & 0x0F)) * lsb;
+
+        return res;
+    }
+
+    // Read a 13 bit ADC register group and scale it
+    bool AxpPMU::read_bits13(AxpRegister reg, float lsb, float& value)
+    {
+        uint8_t data[2] = { 0, 0 };
+        bool res = read(address, static_cast<uint8_t>(reg), data, sizeof(data));
+        value = static_cast<float>((data[0] << 5) | (data[1] & 0x1F)) * lsb;
+
+        return res;
+    }
+
+    // Combine the 4 registers of a coulomb counter, most significant first
+    uint32_t AxpPMU::to_bits32(const uint8_t* data)
+    {
+        return (static_cast<uint32_t>(data[0]) << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+    }
+}
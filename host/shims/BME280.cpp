@@ -0,0 +1,102 @@
+/****************************************************************************************
+ * BME280.cpp - Host version of the Smooth BME280 driver, used for the BMP280
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <smooth/application/io/i2c/BME280.h>
+#include "sim/Bmp280Compensation.h"
+
+namespace smooth::application::sensor
+{
+    // Class constants
+    static constexpr uint8_t REG_TRIMMING = 0x88;
+    static constexpr uint8_t REG_RESET = 0xE0;
+    static constexpr uint8_t REG_STATUS = 0xF3;
+    static constexpr uint8_t REG_CTRL_MEAS = 0xF4;
+    static constexpr uint8_t REG_PRESS_MSB = 0xF7;
+
+    // Constructor
+    BME280::BME280(i2c_port_t port, uint8_t address, std::mutex& guard) : I2CMasterDevice(port, address, guard)
+    {
+    }
+
+    // Soft reset the sensor
+    bool BME280::reset()
+    {
+        std::vector<uint8_t> data{ REG_RESET, 0xB6 };
+        trimming_read = false;
+
+        return write(address, data);
+    }
+
+    // Read the measuring and NVM copy status bits
+    bool BME280::read_status(bool& measuring, bool& im_update)
+    {
+        uint8_t status;
+        bool res = read(address, REG_STATUS, &status, 1);
+
+        if (res)
+        {
+            measuring = (status & 0x08) != 0;
+            im_update = (status & 0x01) != 0;
+        }
+
+        return res;
+    }
+
+    // Write the mode, oversampling, standby time and filter, ctrl_meas and config are
+    // consecutive so they are written in one transaction
+    bool BME280::configure_sensor(SensorMode mode,
+                                  OverSampling /*humidity*/,
+                                  OverSampling pressure,
+                                  OverSampling temperature,
+                                  StandbyTimeMS standby,
+                                  FilterCoeff filter)
+    {
+        auto ctrl_meas = static_cast<uint8_t>((static_cast<uint8_t>(temperature) << 5)
+                                              | (static_cast<uint8_t>(pressure) << 2)
+                                              | static_cast<uint8_t>(mode));
+        auto config = static_cast<uint8_t>((static_cast<uint8_t>(standby) << 5)
+                                           | (static_cast<uint8_t>(filter) << 2));
+
+        std::vector<uint8_t> data{ REG_CTRL_MEAS, ctrl_meas, config };
+
+        return write(address, data);
+    }
+
+    // Read the measurements
+    bool BME280::read_measurements(float& humidity, float& pressure, float& temperature)
+    {
+        if (!trimming_read)
+        {
+            trimming_read = read(address, REG_TRIMMING, trimming.data(), trimming.size());
+        }
+
+        uint8_t data[6];
+        bool res = trimming_read && read(address, REG_PRESS_MSB, data, sizeof(data));
+
+        if (res)
+        {
+            auto trim = redstone::Bmp280Trimming::decode(trimming.data());
+            int32_t adc_P = (data[0] << 12) | (data[1] << 4) | (data[2] >> 4);
+            int32_t adc_T = (data[3] << 12) | (data[4] << 4) | (data[5] >> 4);
+
+            humidity = 0.0f;
+            temperature = trim.temperature(adc_T);
+            pressure = trim.pressure(adc_P, adc_T) / 100.0f;
+        }
+
+        return res;
+    }
+}
@@ -0,0 +1,46 @@
+/****************************************************************************************
+ * DHT12.cpp - Host version of the Smooth DHT12 driver
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <smooth/application/io/i2c/DHT12.h>
+
+namespace smooth::application::sensor
+{
+    // Constructor
+    DHT12::DHT12(i2c_port_t port, uint8_t address, std::mutex& guard) : I2CMasterDevice(port, address, guard)
+    {
+    }
+
+    // Read the humidity and the temperature, registers 0x00 - 0x04
+    bool DHT12::read_measurements(float& humidity, float& temperature)
+    {
+        uint8_t data[5];
+        bool res = read(address, 0x00, data, sizeof(data));
+        res = res && static_cast<uint8_t>(data[0] + data[1] + data[2] + data[3]) == data[4];
+
+        if (res)
+        {
+            humidity = data[0] + (data[1] & 0x7F) * 0.1f;
+            temperature = data[2] + (data[3] & 0x7F) * 0.1f;
+
+            if (data[3] & 0x80)
+            {
+                temperature = -temperature;
+            }
+        }
+
+        return res;
+    }
+}
@@ -0,0 +1,70 @@
+/****************************************************************************************
+ * I2CMasterDevice.cpp - Host version of the Smooth I2C master device, talks to the simulated bus
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <smooth/core/io/i2c/I2CMasterDevice.h>
+#include <smooth/core/io/i2c/Master.h>
+#include "sim/SimI2cBus.h"
+
+using namespace redstone;
+
+namespace smooth::core::io::i2c
+{
+    // Constructor
+    I2CMasterDevice::I2CMasterDevice(i2c_port_t port, uint8_t address, std::mutex& guard)
+            : port(port), address(address), guard(guard)
+    {
+    }
+
+    // Is the device answering on the bus
+    bool I2CMasterDevice::is_present() const
+    {
+        std::lock_guard<std::mutex> lock(guard);
+
+        return SimI2cBus::instance(port).probe(address);
+    }
+
+    // Write data, the first byte is the register address
+    bool I2CMasterDevice::write(uint8_t device_address, std::vector<uint8_t>& data, bool /*expect_ack*/)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+
+        return SimI2cBus::instance(port).write(device_address, data);
+    }
+
+    // Read registers with a repeated start
+    bool I2CMasterDevice::read(uint8_t device_address, uint8_t slave_register,
+                               core::util::FixedBufferBase<uint8_t>& data,
+                               bool /*use_restart_signal*/, bool /*end_with_nack*/)
+    {
+        return read(device_address, slave_register, data.data(), data.size());
+    }
+
+    // Read registers into a plain buffer
+    bool I2CMasterDevice::read(uint8_t device_address, uint8_t slave_register, uint8_t* data, size_t length)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+
+        return SimI2cBus::instance(port).read(device_address, slave_register, data, length);
+    }
+
+    // Constructor
+    Master::Master(i2c_port_t port, gpio_num_t /*scl*/, bool /*scl_internal_pullup_enable*/,
+                   gpio_num_t /*sda*/, bool /*sda_internal_pullup_enable*/, int clock_frequency)
+            : port(port)
+    {
+        SimI2cBus::instance(port).set_clock_frequency(clock_frequency);
+    }
+}
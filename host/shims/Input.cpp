@@ -0,0 +1,32 @@
+/****************************************************************************************
+ * Input.cpp - Host version of the Smooth gpio input, reads the simulated buttons
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <smooth/core/io/Input.h>
+#include "sim/SimButtons.h"
+
+namespace smooth::core::io
+{
+    // Constructor
+    Input::Input(gpio_num_t io, bool /*pull_up*/, bool /*pull_down*/) : io(io)
+    {
+    }
+
+    // Read the level of the input
+    bool Input::read() const
+    {
+        return redstone::SimButtons::instance().read(io);
+    }
+}
@@ -0,0 +1,128 @@
+/****************************************************************************************
+ * LCDSpi.cpp - Host version of the Smooth LCD SPI device, writes to the simulated display
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <smooth/application/display/LCDSpi.h>
+#include <smooth/core/io/spi/Master.h>
+#include "sim/SimDisplay.h"
+
+using namespace redstone;
+
+namespace smooth::core::io::spi
+{
+    std::mutex Master::guard{};
+
+    // Initialize the SPI host, nothing to do on the host
+    bool Master::initialize(spi_host_device_t /*host*/, SPI_DMA_Channel /*dma_channel*/,
+                            gpio_num_t /*mosi*/, gpio_num_t /*miso*/, gpio_num_t /*clock*/,
+                            int /*transfer_size*/, gpio_num_t /*quadwp_io_num*/, gpio_num_t /*quadhd_io_num*/)
+    {
+        return true;
+    }
+}
+
+namespace smooth::application::display
+{
+    // Class constants
+    static constexpr uint8_t CMD_SWRESET = 0x01;
+    static constexpr uint8_t CMD_MADCTL = 0x36;
+
+    // Constructor
+    LCDSpi::LCDSpi(std::mutex& guard,
+                   gpio_num_t /*chip_select*/,
+                   gpio_num_t /*data_command*/,
+                   uint8_t /*spi_command_bits*/,
+                   uint8_t /*spi_address_bits*/,
+                   uint8_t /*bits_between_address_and_data_phase*/,
+                   uint8_t /*spi_mode*/,
+                   uint8_t /*spi_positive_duty_cycle*/,
+                   uint8_t /*spi_cs_ena_posttrans*/,
+                   int spi_clock_speed_hz,
+                   uint32_t /*spi_device_flags*/,
+                   int /*spi_queue_size*/,
+                   bool /*use_pre_transaction_callback*/,
+                   bool /*use_post_transaction_callback*/)
+            : guard(guard)
+    {
+        SimDisplay::instance().set_clock_frequency(spi_clock_speed_hz);
+    }
+
+    // Initialize the device
+    bool LCDSpi::init(spi_host_device_t /*host*/)
+    {
+        return true;
+    }
+
+    // Add the reset pin
+    void LCDSpi::add_reset_pin(std::unique_ptr<DisplayPin> pin)
+    {
+        reset_pin = std::move(pin);
+    }
+
+    // Software reset
+    void LCDSpi::sw_reset(std::chrono::milliseconds /*delay_time*/)
+    {
+        send_cmd(CMD_SWRESET);
+    }
+
+    // Send the initialization commands
+    bool LCDSpi::send_init_cmds(const display_init_cmd_t* init_cmds, size_t length)
+    {
+        bool res = true;
+
+        for (size_t i = 0; i < length; i++)
+        {
+            res &= send_cmd_with_data(init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].length);
+        }
+
+        return res;
+    }
+
+    // Send a command without parameters
+    bool LCDSpi::send_cmd(uint8_t cmd)
+    {
+        return send_cmd_with_data(cmd, nullptr, 0);
+    }
+
+    // Send a command with parameters
+    bool LCDSpi::send_cmd_with_data(uint8_t cmd, const uint8_t* data, size_t length)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        SimDisplay::instance().command(cmd, data, length);
+
+        return true;
+    }
+
+    // Set the memory data access control
+    bool LCDSpi::set_madctl(uint8_t value)
+    {
+        return send_cmd_with_data(CMD_MADCTL, &value, 1);
+    }
+
+    // Send pixel data for an address window, returns once the data is queued
+    bool LCDSpi::send_lines(int x1, int y1, int x2, int y2, const uint8_t* data, size_t length)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        SimDisplay::instance().write_pixels(x1, y1, x2, y2, data, length);
+
+        return true;
+    }
+
+    // Wait for the pixel data to be sent
+    void LCDSpi::wait_for_send_lines_to_finish()
+    {
+        SimDisplay::instance().wait_until_idle();
+    }
+}
@@ -0,0 +1,152 @@
+/****************************************************************************************
+ * PCF8563.cpp - Host version of the Smooth PCF8563 real time clock driver
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <smooth/application/io/i2c/PCF8563.h>
+#include <sstream>
+#include <iomanip>
+
+namespace smooth::application::sensor
+{
+    // Class constants
+    static constexpr uint8_t REG_CONTROL_2 = 0x01;
+    static constexpr uint8_t REG_SECONDS = 0x02;
+    static constexpr uint8_t REG_MINUTE_ALARM = 0x09;
+    static constexpr uint8_t ALARM_FLAG = 0x08;
+    static constexpr uint8_t ALARM_DISABLED = 0x80;
+
+    static uint8_t to_bcd(int value)
+    {
+        return static_cast<uint8_t>(((value / 10) << 4) | (value % 10));
+    }
+
+    static uint8_t from_bcd(uint8_t value)
+    {
+        return static_cast<uint8_t>(((value >> 4) & 0x0F) * 10 + (value & 0x0F));
+    }
+
+    // Constructor
+    PCF8563::PCF8563(i2c_port_t port, uint8_t address, std::mutex& guard) : I2CMasterDevice(port, address, guard)
+    {
+    }
+
+    // Set the time, registers 0x02 - 0x08
+    bool PCF8563::set_rtc_time(const RtcTime& time)
+    {
+        std::vector<uint8_t> data{ REG_SECONDS,
+                                   to_bcd(time.seconds),
+                                   to_bcd(time.minutes),
+                                   to_bcd(time.hours24),
+                                   to_bcd(time.days),
+                                   static_cast<uint8_t>(time.weekdays),
+                                   to_bcd(static_cast<int>(time.months)),
+                                   to_bcd(time.years % 100) };
+
+        return write(address, data);
+    }
+
+    // Get the time
+    bool PCF8563::get_rtc_time(RtcTime& time)
+    {
+        uint8_t data[7];
+        bool res = read(address, REG_SECONDS, data, sizeof(data));
+
+        if (res)
+        {
+            time.seconds = from_bcd(data[0] & 0x7F);
+            time.minutes = from_bcd(data[1] & 0x7F);
+            time.hours24 = from_bcd(data[2] & 0x3F);
+            time.days = from_bcd(data[3] & 0x3F);
+            time.weekdays = static_cast<DayOfWeek>(data[4] & 0x07);
+            time.months = static_cast<Month>(from_bcd(data[5] & 0x1F));
+            time.years = static_cast<uint16_t>(2000 + from_bcd(data[6]));
+        }
+
+        return res;
+    }
+
+    // Set the alarm, registers 0x09 - 0x0C, bit 7 disables a field
+    bool PCF8563::set_alarm_time(const AlarmTime& time)
+    {
+        auto field = [](int value, bool enabled) {
+                         return static_cast<uint8_t>(to_bcd(value) | (enabled ? 0x00 : ALARM_DISABLED));
+                     };
+
+        std::vector<uint8_t> data{ REG_MINUTE_ALARM,
+                                   field(time.minute, time.ena_alrm_minute),
+                                   field(time.hour24, time.ena_alrm_hour),
+                                   field(time.day, time.ena_alrm_day),
+                                   field(static_cast<int>(time.weekday), time.ena_alrm_weekday) };
+
+        return write(address, data);
+    }
+
+    // Get the alarm
+    bool PCF8563::get_alarm_time(AlarmTime& time)
+    {
+        uint8_t data[4];
+        bool res = read(address, REG_MINUTE_ALARM, data, sizeof(data));
+
+        if (res)
+        {
+            time.minute = from_bcd(data[0] & 0x7F);
+            time.hour24 = from_bcd(data[1] & 0x3F);
+            time.day = from_bcd(data[2] & 0x3F);
+            time.weekday = static_cast<DayOfWeek>(data[3] & 0x07);
+            time.ena_alrm_minute = !(data[0] & ALARM_DISABLED);
+            time.ena_alrm_hour = !(data[1] & ALARM_DISABLED);
+            time.ena_alrm_day = !(data[2] & ALARM_DISABLED);
+            time.ena_alrm_weekday = !(data[3] & ALARM_DISABLED);
+        }
+
+        return res;
+    }
+
+    // Is the alarm flag set
+    bool PCF8563::is_alarm_flag_active(bool& active)
+    {
+        uint8_t control;
+        bool res = read(address, REG_CONTROL_2, &control, 1);
+        active = res && (control & ALARM_FLAG);
+
+        return res;
+    }
+
+    // Clear the alarm flag
+    bool PCF8563::clear_alarm_flag()
+    {
+        uint8_t control;
+        bool res = read(address, REG_CONTROL_2, &control, 1);
+
+        if (res)
+        {
+            std::vector<uint8_t> data{ REG_CONTROL_2, static_cast<uint8_t>(control & ~ALARM_FLAG) };
+            res = write(address, data);
+        }
+
+        return res;
+    }
+
+    // Format a time as "1:08:00 PM"
+    std::string PCF8563::get_12hr_time_string(uint8_t hours24, uint8_t minutes, uint8_t seconds)
+    {
+        int hours12 = hours24 % 12 == 0 ? 12 : hours24 % 12;
+        std::ostringstream stream;
+        stream << hours12 << ":" << std::setfill('0') << std::setw(2) << static_cast<int>(minutes)
+               << ":" << std::setw(2) << static_cast<int>(seconds) << (hours24 < 12 ? " AM" : " PM");
+
+        return stream.str();
+    }
+}
@@ -0,0 +1,126 @@
+/****************************************************************************************
+ * Axp192Model.cpp - A simulated AXP192 power management IC
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "sim/Axp192Model.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+namespace redstone
+{
+    // Constructor
+    Axp192Model::Axp192Model() : SimI2cDevice("axp192", 0x34)
+    {
+    }
+
+    // Set a parameter of the device
+    bool Axp192Model::set_parameter(const std::string& parameter, float value)
+    {
+        std::unique_lock<std::mutex> lock(guard);
+
+        const std::map<std::string, float*> parameters = {
+            { "acin_voltage", &acin_voltage },
+            { "acin_current", &acin_current },
+            { "vbus_voltage", &vbus_voltage },
+            { "vbus_current", &vbus_current },
+            { "temperature", &temperature },
+            { "ts_voltage", &ts_voltage },
+            { "battery_voltage", &battery_voltage },
+            { "charge_current", &charge_current },
+            { "discharge_current", &discharge_current },
+            { "aps_voltage", &aps_voltage }
+        };
+
+        auto it = parameters.find(parameter);
+        bool res = it != parameters.end();
+
+        if (res)
+        {
+            *it->second = value;
+        }
+        else
+        {
+            lock.unlock();
+            res = SimI2cDevice::set_parameter(parameter, value);
+        }
+
+        return res;
+    }
+
+    // Encode the measurements into the ADC and coulomb counter registers
+    void Axp192Model::update(int64_t now_us)
+    {
+        if (last_update_us >= 0)
+        {
+            double hours = static_cast<double>(now_us - last_update_us) / 3600.0e6;
+            charge_mAh += charge_current * hours;
+            discharge_mAh += discharge_current * hours;
+        }
+
+        last_update_us = now_us;
+
+        set_bits12(0x56, with_noise(acin_voltage) * 1000.0f, 1.7f);
+        set_bits12(0x58, with_noise(acin_current), 0.625f);
+        set_bits12(0x5A, with_noise(vbus_voltage) * 1000.0f, 1.7f);
+        set_bits12(0x5C, with_noise(vbus_current), 0.375f);
+        set_bits12(0x5E, with_noise(temperature) + 144.7f, 0.1f);
+        set_bits12(0x62, with_noise(ts_voltage) * 1000.0f, 0.8f);
+
+        // battery power lsb is 1.1mV * 0.5mA, the power is drawn from the battery when discharging
+        auto power = static_cast<uint32_t>(std::max(0.0f, battery_voltage * 1000.0f * discharge_current / 0.55f));
+        registers[0x70] = static_cast<uint8_t>(power >> 16);
+        registers[0x71] = static_cast<uint8_t>(power >> 8);
+        registers[0x72] = static_cast<uint8_t>(power);
+
+        set_bits12(0x78, with_noise(battery_voltage) * 1000.0f, 1.1f);
+        set_bits13(0x7A, with_noise(charge_current), 0.5f);
+        set_bits13(0x7C, with_noise(discharge_current), 0.5f);
+        set_bits12(0x7E, with_noise(aps_voltage) * 1000.0f, 1.4f);
+
+        // mAh = 65536 * 0.5mA * counts / 3600s / adc sample rate
+        auto counts = [](double mAh) {
+                          return static_cast<uint32_t>(mAh * 3600.0 * ADC_SAMPLE_RATE_HZ / (65536.0 * 0.5));
+                      };
+
+        set_bits32(0xB0, counts(charge_mAh));
+        set_bits32(0xB4, counts(discharge_mAh));
+    }
+
+    // Encode a 12 bit ADC value
+    void Axp192Model::set_bits12(uint8_t msb_register, float value, float lsb)
+    {
+        auto raw = static_cast<uint32_t>(std::clamp(std::lround(value / lsb), 0L, 0xFFFL));
+        registers[msb_register] = static_cast<uint8_t>(raw >> 4);
+        registers[msb_register + 1] = static_cast<uint8_t>(raw & 0x0F);
+    }
+
+    // Encode a 13 bit ADC value
+    void Axp192Model::set_bits13(uint8_t msb_register, float value, float lsb)
+    {
+        auto raw = static_cast<uint32_t>(std::clamp(std::lround(value / lsb), 0L, 0x1FFFL));
+        registers[msb_register] = static_cast<uint8_t>(raw >> 5);
+        registers[msb_register + 1] = static_cast<uint8_t>(raw & 0x1F);
+    }
+
+    // Encode a 32 bit counter
+    void Axp192Model::set_bits32(uint8_t msb_register, uint32_t value)
+    {
+        registers[msb_register] = static_cast<uint8_t>(value >> 24);
+        registers[msb_register + 1] = static_cast<uint8_t>(value >> 16);
+        registers[msb_register + 2] = static_cast<uint8_t>(value >> 8);
+        registers[msb_register + 3] = static_cast<uint8_t>(value);
+    }
+}
@@ -0,0 +1,76 @@
+/****************************************************************************************
+ * Axp192Model.h - A simulated AXP192 power management IC
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The configuration registers are plain storage.  The ADC block (0x56 - 0x7F) and the
+//  coulomb counters (0xB0 - 0xB7) are encoded with the scaling documented in
+//  model/Axp192.h, the coulomb counters integrate the charge and discharge currents at
+//  the 200Hz ADC sample rate the firmware configures.
+//
+//  Parameters: acin_voltage, vbus_voltage, ts_voltage, battery_voltage, aps_voltage (V),
+//  acin_current, vbus_current, charge_current, discharge_current (mA), temperature (C)
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "sim/SimI2cDevice.h"
+
+namespace redstone
+{
+    class Axp192Model : public SimI2cDevice
+    {
+        public:
+            /// Constructor
+            Axp192Model();
+
+            /// Set a parameter of the device
+            /// \param parameter The name of the parameter
+            /// \param value The new value
+            /// \return true if the parameter exists
+            bool set_parameter(const std::string& parameter, float value) override;
+
+        protected:
+            /// Encode the measurements into the ADC and coulomb counter registers
+            void update(int64_t now_us) override;
+
+        private:
+            /// Encode a 12 bit ADC value
+            void set_bits12(uint8_t msb_register, float value, float lsb);
+
+            /// Encode a 13 bit ADC value
+            void set_bits13(uint8_t msb_register, float value, float lsb);
+
+            /// Encode a 32 bit counter
+            void set_bits32(uint8_t msb_register, uint32_t value);
+
+            static constexpr float ADC_SAMPLE_RATE_HZ = 200.0f;
+
+            float acin_voltage{ 0.0f };
+            float acin_current{ 0.0f };
+            float vbus_voltage{ 5.02f };
+            float vbus_current{ 96.0f };
+            float temperature{ 38.5f };
+            float ts_voltage{ 0.0f };
+            float battery_voltage{ 4.12f };
+            float charge_current{ 0.0f };
+            float discharge_current{ 0.0f };
+            float aps_voltage{ 4.94f };
+
+            double charge_mAh{ 0.0 };
+            double discharge_mAh{ 0.0 };
+            int64_t last_update_us{ -1 };
+    };
+}
@@ -0,0 +1,122 @@
+/****************************************************************************************
+ * Bm8563Model.cpp - A simulated BM8563 (PCF8563 compatible) real time clock
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "sim/Bm8563Model.h"
+
+namespace redstone
+{
+    // Class constants
+    static constexpr uint8_t REG_CONTROL_2 = 0x01;
+    static constexpr uint8_t REG_SECONDS = 0x02;
+    static constexpr uint8_t REG_YEARS = 0x08;
+    static constexpr uint8_t REG_MINUTE_ALARM = 0x09;
+    static constexpr uint8_t ALARM_FLAG = 0x08;
+    static constexpr uint8_t ALARM_DISABLED = 0x80;
+    static constexpr std::time_t JANUARY_1_2020 = 1577836800;
+
+    static uint8_t to_bcd(int value)
+    {
+        return static_cast<uint8_t>(((value / 10) << 4) | (value % 10));
+    }
+
+    static int from_bcd(uint8_t value)
+    {
+        return ((value >> 4) & 0x0F) * 10 + (value & 0x0F);
+    }
+
+    // Constructor
+    Bm8563Model::Bm8563Model() : SimI2cDevice("bm8563", 0x51), base_time(JANUARY_1_2020)
+    {
+        for (uint8_t reg = REG_MINUTE_ALARM; reg <= REG_MINUTE_ALARM + 3; reg++)
+        {
+            registers[reg] = ALARM_DISABLED;
+        }
+
+        update(0);
+    }
+
+    // Advance the time registers and check the alarm
+    void Bm8563Model::update(int64_t now_us)
+    {
+        std::time_t now = base_time + static_cast<std::time_t>((now_us - base_us) / 1000000);
+        std::tm tm{};
+        gmtime_r(&now, &tm);
+
+        registers[REG_SECONDS] = to_bcd(tm.tm_sec);
+        registers[REG_SECONDS + 1] = to_bcd(tm.tm_min);
+        registers[REG_SECONDS + 2] = to_bcd(tm.tm_hour);
+        registers[REG_SECONDS + 3] = to_bcd(tm.tm_mday);
+        registers[REG_SECONDS + 4] = static_cast<uint8_t>(tm.tm_wday);
+        registers[REG_SECONDS + 5] = to_bcd(tm.tm_mon + 1);
+        registers[REG_YEARS] = to_bcd(tm.tm_year % 100);
+
+        int minute_of_epoch = static_cast<int>(now / 60);
+
+        if (minute_of_epoch != last_checked_minute)
+        {
+            last_checked_minute = minute_of_epoch;
+
+            if (is_alarm_matching())
+            {
+                registers[REG_CONTROL_2] |= ALARM_FLAG;
+            }
+        }
+    }
+
+    // Restart the clock when the time registers are written
+    void Bm8563Model::register_written(uint8_t reg, uint8_t value, int64_t now_us)
+    {
+        registers[reg] = value;
+
+        if (reg >= REG_SECONDS && reg <= REG_YEARS)
+        {
+            std::tm tm{};
+            tm.tm_sec = from_bcd(registers[REG_SECONDS] & 0x7F);
+            tm.tm_min = from_bcd(registers[REG_SECONDS + 1] & 0x7F);
+            tm.tm_hour = from_bcd(registers[REG_SECONDS + 2] & 0x3F);
+            tm.tm_mday = from_bcd(registers[REG_SECONDS + 3] & 0x3F);
+            tm.tm_mon = from_bcd(registers[REG_SECONDS + 5] & 0x1F) - 1;
+            tm.tm_year = 100 + from_bcd(registers[REG_YEARS]);
+
+            base_time = timegm(&tm);
+            base_us = now_us;
+            last_checked_minute = static_cast<int>(base_time / 60);
+        }
+    }
+
+    // Is the alarm matching the time in the registers
+    bool Bm8563Model::is_alarm_matching() const
+    {
+        bool any_enabled = false;
+        bool matching = true;
+
+        // minute, hour, day and weekday alarms with the time register they are compared with
+        const uint8_t time_registers[] = { REG_SECONDS + 1, REG_SECONDS + 2, REG_SECONDS + 3, REG_SECONDS + 4 };
+
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            uint8_t alarm = registers[REG_MINUTE_ALARM + i];
+
+            if (!(alarm & ALARM_DISABLED))
+            {
+                any_enabled = true;
+                matching &= (alarm & 0x7F) == (registers[time_registers[i]] & 0x7F);
+            }
+        }
+
+        return any_enabled && matching;
+    }
+}
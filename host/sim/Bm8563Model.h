@@ -0,0 +1,54 @@
+/****************************************************************************************
+ * Bm8563Model.h - A simulated BM8563 (PCF8563 compatible) real time clock
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The time registers (0x02 - 0x08, BCD) run from the last time written at the rate of
+//  the simulated clock.  The alarm registers (0x09 - 0x0C) are compared with the time
+//  once per minute, a match sets the alarm flag, bit 3 of control/status 2 (0x01), until
+//  it is cleared by a write.
+//
+//  The clock starts at 2020-01-01 00:00:00 until the firmware sets it.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <ctime>
+#include "sim/SimI2cDevice.h"
+
+namespace redstone
+{
+    class Bm8563Model : public SimI2cDevice
+    {
+        public:
+            /// Constructor
+            Bm8563Model();
+
+        protected:
+            /// Advance the time registers and check the alarm
+            void update(int64_t now_us) override;
+
+            /// Restart the clock when the time registers are written
+            void register_written(uint8_t reg, uint8_t value, int64_t now_us) override;
+
+        private:
+            /// Is the alarm matching the time in the registers
+            bool is_alarm_matching() const;
+
+            std::time_t base_time;
+            int64_t base_us{ 0 };
+            int last_checked_minute{ -1 };
+    };
+}
@@ -0,0 +1,99 @@
+/****************************************************************************************
+ * Bmp280Compensation.h - The BMP280 datasheet compensation formulas
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The integer compensation formulas of the BMP280 datasheet (section 8.2).  The host
+//  BME280 driver uses them to convert the raw ADC values, the BMP280 model uses them
+//  the other way round to find the raw ADC values of the temperature and pressure it
+//  simulates, so the whole register path is exercised.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+
+namespace redstone
+{
+    struct Bmp280Trimming
+    {
+        uint16_t dig_T1;
+        int16_t dig_T2;
+        int16_t dig_T3;
+        uint16_t dig_P1;
+        int16_t dig_P2;
+        int16_t dig_P3;
+        int16_t dig_P4;
+        int16_t dig_P5;
+        int16_t dig_P6;
+        int16_t dig_P7;
+        int16_t dig_P8;
+        int16_t dig_P9;
+
+        /// Decode the trimming parameters from registers 0x88 - 0x9F
+        /// \param regs The 24 registers
+        static Bmp280Trimming decode(const uint8_t* regs)
+        {
+            auto u16 = [regs](int i) { return static_cast<uint16_t>(regs[i] | (regs[i + 1] << 8)); };
+            auto s16 = [&u16](int i) { return static_cast<int16_t>(u16(i)); };
+
+            return { u16(0), s16(2), s16(4), u16(6), s16(8), s16(10),
+                     s16(12), s16(14), s16(16), s16(18), s16(20), s16(22) };
+        }
+
+        /// The fine temperature used by the pressure compensation
+        /// \param adc_T The raw temperature
+        int32_t t_fine(int32_t adc_T) const
+        {
+            int32_t var1 = ((((adc_T >> 3) - (static_cast<int32_t>(dig_T1) << 1))) * dig_T2) >> 11;
+            int32_t var2 = (((((adc_T >> 4) - dig_T1) * ((adc_T >> 4) - dig_T1)) >> 12) * dig_T3) >> 14;
+
+            return var1 + var2;
+        }
+
+        /// Temperature in degree celsius
+        /// \param adc_T The raw temperature
+        float temperature(int32_t adc_T) const
+        {
+            return ((t_fine(adc_T) * 5 + 128) >> 8) / 100.0f;
+        }
+
+        /// Pressure in Pa
+        /// \param adc_P The raw pressure
+        /// \param adc_T The raw temperature
+        float pressure(int32_t adc_P, int32_t adc_T) const
+        {
+            int64_t var1 = static_cast<int64_t>(t_fine(adc_T)) - 128000;
+            int64_t var2 = var1 * var1 * dig_P6;
+            var2 = var2 + ((var1 * dig_P5) << 17);
+            var2 = var2 + (static_cast<int64_t>(dig_P4) << 35);
+            var1 = ((var1 * var1 * dig_P3) >> 8) + ((var1 * dig_P2) << 12);
+            var1 = (((static_cast<int64_t>(1) << 47) + var1)) * dig_P1 >> 33;
+
+            if (var1 == 0)
+            {
+                return 0.0f;
+            }
+
+            int64_t p = 1048576 - adc_P;
+            p = (((p << 31) - var2) * 3125) / var1;
+            var1 = (static_cast<int64_t>(dig_P9) * (p >> 13) * (p >> 13)) >> 25;
+            var2 = (static_cast<int64_t>(dig_P8) * p) >> 19;
+            p = ((p + var1 + var2) >> 8) + (static_cast<int64_t>(dig_P7) << 4);
+
+            return static_cast<float>(p) / 256.0f;
+        }
+    };
+}
@@ -0,0 +1,183 @@
+/****************************************************************************************
+ * Bmp280Model.cpp - A simulated BMP280 pressure and temperature sensor
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "sim/Bmp280Model.h"
+#include <algorithm>
+
+namespace redstone
+{
+    // Class constants
+    static constexpr uint8_t REG_TRIMMING = 0x88;
+    static constexpr uint8_t REG_CHIP_ID = 0xD0;
+    static constexpr uint8_t REG_RESET = 0xE0;
+    static constexpr uint8_t REG_STATUS = 0xF3;
+    static constexpr uint8_t REG_CTRL_MEAS = 0xF4;
+    static constexpr uint8_t REG_CONFIG = 0xF5;
+    static constexpr uint8_t REG_PRESS_MSB = 0xF7;
+    static constexpr uint8_t BMP280_CHIP_ID = 0x58;
+    static constexpr uint8_t RESET_VALUE = 0xB6;
+    static constexpr int32_t ADC_MAX = (1 << 20) - 1;
+
+    // The example trimming parameters of the datasheet
+    static constexpr Bmp280Trimming DATASHEET_TRIMMING = { 27504, 26435, -1000, 36477, -10685, 3024,
+                                                           2855, 140, -7, 15500, -14600, 6000 };
+
+    // Constructor
+    Bmp280Model::Bmp280Model() : SimI2cDevice("bmp280", 0x76), trimming(DATASHEET_TRIMMING)
+    {
+        const uint16_t words[] = { trimming.dig_T1,
+                                   static_cast<uint16_t>(trimming.dig_T2),
+                                   static_cast<uint16_t>(trimming.dig_T3),
+                                   trimming.dig_P1,
+                                   static_cast<uint16_t>(trimming.dig_P2),
+                                   static_cast<uint16_t>(trimming.dig_P3),
+                                   static_cast<uint16_t>(trimming.dig_P4),
+                                   static_cast<uint16_t>(trimming.dig_P5),
+                                   static_cast<uint16_t>(trimming.dig_P6),
+                                   static_cast<uint16_t>(trimming.dig_P7),
+                                   static_cast<uint16_t>(trimming.dig_P8),
+                                   static_cast<uint16_t>(trimming.dig_P9) };
+
+        for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++)
+        {
+            registers[REG_TRIMMING + 2 * i] = static_cast<uint8_t>(words[i] & 0xFF);
+            registers[REG_TRIMMING + 2 * i + 1] = static_cast<uint8_t>(words[i] >> 8);
+        }
+
+        registers[REG_CHIP_ID] = BMP280_CHIP_ID;
+        convert();
+    }
+
+    // Set a parameter of the device
+    bool Bmp280Model::set_parameter(const std::string& parameter, float value)
+    {
+        std::unique_lock<std::mutex> lock(guard);
+        bool res = true;
+
+        if (parameter == "temperature")
+        {
+            temperature = value;
+        }
+        else if (parameter == "pressure")
+        {
+            pressure = value;
+        }
+        else
+        {
+            lock.unlock();
+            res = SimI2cDevice::set_parameter(parameter, value);
+        }
+
+        return res;
+    }
+
+    // Update the status and the result registers
+    void Bmp280Model::update(int64_t now_us)
+    {
+        bool normal_mode = (registers[REG_CTRL_MEAS] & 0x03) == 0x03;
+
+        if (conversion_done_us >= 0 && now_us >= conversion_done_us)
+        {
+            // the forced conversion has finished, back to sleep mode
+            convert();
+            conversion_done_us = -1;
+            registers[REG_CTRL_MEAS] &= 0xFC;
+        }
+        else if (normal_mode)
+        {
+            convert();
+        }
+
+        bool measuring = conversion_done_us >= 0 || normal_mode;
+        bool im_update = now_us < nvm_copied_us;
+        registers[REG_STATUS] = static_cast<uint8_t>((measuring ? 0x08 : 0x00) | (im_update ? 0x01 : 0x00));
+    }
+
+    // Handle reset and ctrl_meas writes
+    void Bmp280Model::register_written(uint8_t reg, uint8_t value, int64_t now_us)
+    {
+        if (reg == REG_RESET)
+        {
+            if (value == RESET_VALUE)
+            {
+                registers[REG_CTRL_MEAS] = 0;
+                registers[REG_CONFIG] = 0;
+                conversion_done_us = -1;
+                nvm_copied_us = now_us + NVM_COPY_US;
+            }
+        }
+        else if (reg == REG_CTRL_MEAS)
+        {
+            registers[reg] = value;
+            uint8_t mode = value & 0x03;
+
+            if (mode == 0x01 || mode == 0x02)
+            {
+                auto samples = [](int osrs) { return osrs == 0 ? 0 : 1 << (std::min(osrs, 5) - 1); };
+                int temperature_samples = samples(value >> 5);
+                int pressure_samples = samples((value >> 2) & 0x07);
+                float conversion_ms = 1.0f + 2.0f * temperature_samples + 2.0f * pressure_samples + 0.5f;
+
+                conversion_done_us = now_us + static_cast<int64_t>(conversion_ms * 1000.0f);
+            }
+        }
+        else if (reg == REG_CONFIG)
+        {
+            registers[reg] = value;
+        }
+    }
+
+    // Convert the simulated temperature and pressure into the raw result registers
+    void Bmp280Model::convert()
+    {
+        // Both compensations are monotonic, find the raw values with a binary search
+        auto search = [](auto compensated, float target, bool increasing) {
+                          int32_t low = 0;
+                          int32_t high = ADC_MAX;
+
+                          while (low < high)
+                          {
+                              int32_t middle = low + (high - low) / 2;
+                              bool below = compensated(middle) < target;
+
+                              if (below == increasing)
+                              {
+                                  low = middle + 1;
+                              }
+                              else
+                              {
+                                  high = middle;
+                              }
+                          }
+
+                          return low;
+                      };
+
+        float target_temperature = with_noise(temperature);
+        float target_pressure_pa = with_noise(pressure) * 100.0f;
+
+        int32_t adc_T = search([this](int32_t adc) { return trimming.temperature(adc); }, target_temperature, true);
+        int32_t adc_P = search([this, adc_T](int32_t adc) { return trimming.pressure(adc, adc_T); },
+                               target_pressure_pa, false);
+
+        registers[REG_PRESS_MSB] = static_cast<uint8_t>(adc_P >> 12);
+        registers[REG_PRESS_MSB + 1] = static_cast<uint8_t>(adc_P >> 4);
+        registers[REG_PRESS_MSB + 2] = static_cast<uint8_t>((adc_P & 0x0F) << 4);
+        registers[REG_PRESS_MSB + 3] = static_cast<uint8_t>(adc_T >> 12);
+        registers[REG_PRESS_MSB + 4] = static_cast<uint8_t>(adc_T >> 4);
+        registers[REG_PRESS_MSB + 5] = static_cast<uint8_t>((adc_T & 0x0F) << 4);
+    }
+}
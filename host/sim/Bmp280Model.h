@@ -0,0 +1,69 @@
+/****************************************************************************************
+ * Bmp280Model.h - A simulated BMP280 pressure and temperature sensor
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Models the parts of the BMP280 the firmware uses:
+//
+//      0x88-0x9F   trimming parameters, the example values of the datasheet
+//      0xD0        chip id 0x58
+//      0xE0        reset, writing 0xB6 copies the NVM for NVM_COPY_US (status bit 0)
+//      0xF3        status, bit 3 measuring, bit 0 im_update
+//      0xF4        ctrl_meas, a forced mode write converts for the datasheet typical
+//                  time of the oversampling settings then returns to sleep mode
+//      0xF7-0xFC   raw pressure and temperature of the last conversion
+//
+//  Parameters: temperature (C), pressure (hPa)
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "sim/SimI2cDevice.h"
+#include "sim/Bmp280Compensation.h"
+
+namespace redstone
+{
+    class Bmp280Model : public SimI2cDevice
+    {
+        public:
+            /// Constructor
+            Bmp280Model();
+
+            /// Set a parameter of the device
+            /// \param parameter The name of the parameter
+            /// \param value The new value
+            /// \return true if the parameter exists
+            bool set_parameter(const std::string& parameter, float value) override;
+
+        protected:
+            /// Update the status and the result registers
+            void update(int64_t now_us) override;
+
+            /// Handle reset and ctrl_meas writes
+            void register_written(uint8_t reg, uint8_t value, int64_t now_us) override;
+
+        private:
+            /// Convert the simulated temperature and pressure into the raw result registers
+            void convert();
+
+            static constexpr int64_t NVM_COPY_US = 2000;
+
+            Bmp280Trimming trimming;
+            float temperature{ 24.6f };
+            float pressure{ 1013.25f };
+            int64_t nvm_copied_us{ 0 };
+            int64_t conversion_done_us{ -1 };
+    };
+}
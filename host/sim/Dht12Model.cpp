@@ -0,0 +1,63 @@
+/****************************************************************************************
+ * Dht12Model.cpp - A simulated DHT12 temperature and humidity sensor
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "sim/Dht12Model.h"
+#include <cmath>
+
+namespace redstone
+{
+    // Constructor
+    Dht12Model::Dht12Model() : SimI2cDevice("dht12", 0x5C)
+    {
+    }
+
+    // Set a parameter of the device
+    bool Dht12Model::set_parameter(const std::string& parameter, float value)
+    {
+        std::unique_lock<std::mutex> lock(guard);
+        bool res = true;
+
+        if (parameter == "temperature")
+        {
+            temperature = value;
+        }
+        else if (parameter == "humidity")
+        {
+            humidity = value;
+        }
+        else
+        {
+            lock.unlock();
+            res = SimI2cDevice::set_parameter(parameter, value);
+        }
+
+        return res;
+    }
+
+    // Encode the measurements into the registers
+    void Dht12Model::update(int64_t /*now_us*/)
+    {
+        int tenths_humidity = static_cast<int>(std::lround(with_noise(humidity) * 10.0f));
+        int tenths_temperature = static_cast<int>(std::lround(with_noise(temperature) * 10.0f));
+        int magnitude = std::abs(tenths_temperature);
+
+        registers[0] = static_cast<uint8_t>(tenths_humidity / 10);
+        registers[1] = static_cast<uint8_t>(tenths_humidity % 10);
+        registers[2] = static_cast<uint8_t>(magnitude / 10);
+        registers[3] = static_cast<uint8_t>((magnitude % 10) | (tenths_temperature < 0 ? 0x80 : 0x00));
+        registers[4] = static_cast<uint8_t>(registers[0] + registers[1] + registers[2] + registers[3]);
+    }
+}
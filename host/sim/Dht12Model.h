@@ -0,0 +1,51 @@
+/****************************************************************************************
+ * Dht12Model.h - A simulated DHT12 temperature and humidity sensor
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Registers 0x00 - 0x04: humidity integer, humidity tenths, temperature integer,
+//  temperature tenths (bit 7 set when negative) and the checksum, the low byte of the
+//  sum of the first four registers.
+//
+//  Parameters: temperature (C), humidity (%RH)
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "sim/SimI2cDevice.h"
+
+namespace redstone
+{
+    class Dht12Model : public SimI2cDevice
+    {
+        public:
+            /// Constructor
+            Dht12Model();
+
+            /// Set a parameter of the device
+            /// \param parameter The name of the parameter
+            /// \param value The new value
+            /// \return true if the parameter exists
+            bool set_parameter(const std::string& parameter, float value) override;
+
+        protected:
+            /// Encode the measurements into the registers
+            void update(int64_t now_us) override;
+
+        private:
+            float temperature{ 26.4f };
+            float humidity{ 41.0f };
+    };
+}
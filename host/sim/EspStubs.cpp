@@ -0,0 +1,47 @@
+/****************************************************************************************
+ * EspStubs.cpp - The ESP-IDF functions the firmware and LittlevGL use, on the host
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <chrono>
+#include <cerrno>
+#include <sys/stat.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <esp_vfs_fat.h>
+
+using namespace std::chrono;
+
+// The simulated boot is the start of the process
+static const steady_clock::time_point boot_time = steady_clock::now();
+
+extern "C" int64_t esp_timer_get_time(void)
+{
+    return duration_cast<microseconds>(steady_clock::now() - boot_time).count();
+}
+
+extern "C" bool heap_caps_check_integrity_all(bool /*print_errors*/)
+{
+    return true;
+}
+
+// The partition is the directory base_path of the working directory
+extern "C" esp_err_t esp_vfs_fat_spiflash_mount(const char* base_path, const char* /*partition_label*/,
+                                                const esp_vfs_fat_mount_config_t* /*mount_config*/,
+                                                wl_handle_t* wl_handle)
+{
+    *wl_handle = 0;
+
+    return mkdir(base_path, 0755) == 0 || errno == EEXIST ? ESP_OK : ESP_FAIL;
+}
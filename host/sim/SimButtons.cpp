@@ -0,0 +1,54 @@
+/****************************************************************************************
+ * SimButtons.cpp - Scripted button presses for the host build
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "sim/SimButtons.h"
+#include <esp_timer.h>
+
+namespace redstone
+{
+    // Get the simulated buttons
+    SimButtons& SimButtons::instance()
+    {
+        static SimButtons buttons;
+
+        return buttons;
+    }
+
+    // Schedule a button press
+    void SimButtons::press(gpio_num_t pin, int64_t at_ms, int64_t hold_ms)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        presses.push_back({ pin, at_ms * 1000, (at_ms + hold_ms) * 1000 });
+    }
+
+    // Read the level of a button
+    bool SimButtons::read(gpio_num_t pin)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        int64_t now_us = esp_timer_get_time();
+        bool level = true;
+
+        for (const auto& press : presses)
+        {
+            if (press.pin == pin && now_us >= press.from_us && now_us < press.until_us)
+            {
+                level = false;
+            }
+        }
+
+        return level;
+    }
+}
@@ -0,0 +1,59 @@
+/****************************************************************************************
+ * SimButtons.h - Scripted button presses for the host build
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The M5StickC buttons read high when not pressed.  A press holds the input of a gpio
+//  low from a time after boot for a duration, the host Input reads it from here.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <driver/gpio.h>
+
+namespace redstone
+{
+    class SimButtons
+    {
+        public:
+            /// Get the simulated buttons
+            static SimButtons& instance();
+
+            /// Schedule a button press
+            /// \param pin The gpio of the button
+            /// \param at_ms The time after boot the button is pressed
+            /// \param hold_ms The time the button is held down
+            void press(gpio_num_t pin, int64_t at_ms, int64_t hold_ms);
+
+            /// Read the level of a button
+            /// \param pin The gpio of the button
+            /// \return false while the button is pressed
+            bool read(gpio_num_t pin);
+
+        private:
+            struct Press
+            {
+                gpio_num_t pin;
+                int64_t from_us;
+                int64_t until_us;
+            };
+
+            std::vector<Press> presses{};
+            std::mutex guard{};
+    };
+}
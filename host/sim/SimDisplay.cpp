@@ -0,0 +1,217 @@
+/****************************************************************************************
+ * SimDisplay.cpp - An in-memory ST7735S frame memory that replaces the LCD on the host
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "sim/SimDisplay.h"
+#include <chrono>
+#include <fstream>
+#include <thread>
+#include <esp_timer.h>
+
+using namespace std::chrono;
+
+namespace redstone
+{
+    // Class constants
+    static constexpr uint8_t CMD_NORON = 0x13;
+    static constexpr uint8_t CMD_INVOFF = 0x20;
+    static constexpr uint8_t CMD_INVON = 0x21;
+    static constexpr uint8_t CMD_VSCRDEF = 0x33;
+    static constexpr uint8_t CMD_MADCTL = 0x36;
+    static constexpr uint8_t CMD_VSCRSADD = 0x37;
+    static constexpr uint8_t COLMOD_12_BIT = 0x03;
+    static constexpr uint8_t MADCTL_MY = 0x80;
+    static constexpr uint8_t MADCTL_MV = 0x20;
+    static constexpr uint8_t CMD_COLMOD = 0x3A;
+
+    // Widen a 12 bit pixel to RGB565, the frame memory holds 18 bits whatever COLMOD
+    static uint16_t from_rgb444(uint16_t pixel)
+    {
+        uint16_t red = (pixel >> 8) & 0x0F;
+        uint16_t green = (pixel >> 4) & 0x0F;
+        uint16_t blue = pixel & 0x0F;
+
+        return static_cast<uint16_t>((((red << 1) | (red >> 3)) << 11) | (((green << 2) | (green >> 2)) << 5) |
+                                     ((blue << 1) | (blue >> 3)));
+    }
+
+    // Get the simulated display
+    SimDisplay& SimDisplay::instance()
+    {
+        static SimDisplay display;
+
+        return display;
+    }
+
+    // A command and its parameters were sent
+    void SimDisplay::command(uint8_t cmd, const uint8_t* data, size_t length)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+
+        if (cmd == CMD_MADCTL && length > 0)
+        {
+            madctl = data[0];
+        }
+        else if (cmd == CMD_COLMOD && length > 0)
+        {
+            colmod = data[0];
+        }
+        else if (cmd == CMD_INVON || cmd == CMD_INVOFF)
+        {
+            inverted = cmd == CMD_INVON;
+        }
+        else if (cmd == CMD_VSCRDEF && length >= 6)
+        {
+            top_fixed_rows = (data[0] << 8) | data[1];
+            scroll_rows = (data[2] << 8) | data[3];
+        }
+        else if (cmd == CMD_VSCRSADD && length >= 2)
+        {
+            scroll_start = (data[0] << 8) | data[1];
+            scrolling = true;
+        }
+        else if (cmd == CMD_NORON)
+        {
+            scrolling = false;
+        }
+
+        transfer(1 + length);
+    }
+
+    // Pixel data was sent for an address window
+    void SimDisplay::write_pixels(int x1, int y1, int x2, int y2, const uint8_t* data, size_t length)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        int x = x1;
+        int y = y1;
+
+        auto store = [&](uint16_t pixel) {
+            if (x >= 0 && x < MEMORY_SIZE && y >= 0 && y < MEMORY_SIZE)
+            {
+                memory[y * MEMORY_SIZE + x] = pixel;
+            }
+
+            if (++x > x2)
+            {
+                x = x1;
+                y += 1;
+            }
+        };
+
+        if (colmod == COLMOD_12_BIT)
+        {
+            // two pixels in three bytes, an odd last pixel in two
+            for (size_t i = 0; i + 1 < length && y <= y2; i += 3)
+            {
+                store(from_rgb444(static_cast<uint16_t>((data[i] << 4) | (data[i + 1] >> 4))));
+
+                if (i + 2 < length && y <= y2)
+                {
+                    store(from_rgb444(static_cast<uint16_t>(((data[i + 1] & 0x0F) << 8) | data[i + 2])));
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i + 1 < length && y <= y2; i += 2)
+            {
+                store(static_cast<uint16_t>((data[i] << 8) | data[i + 1]));
+            }
+        }
+
+        // the CASET, RASET and RAMWR commands take 11 bytes
+        transfer(11 + length);
+        pixel_bytes += length;
+        transfers += 1;
+    }
+
+    // Sleep until the last transfer is done
+    void SimDisplay::wait_until_idle()
+    {
+        int64_t wait_us;
+
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            wait_us = busy_until_us - esp_timer_get_time();
+        }
+
+        if (wait_us > 0)
+        {
+            std::this_thread::sleep_for(microseconds(wait_us));
+        }
+    }
+
+    // Write a region of the frame memory to a binary PPM file
+    bool SimDisplay::write_ppm(const std::string& path, int x, int y, int width, int height)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        std::ofstream file(path, std::ios::binary);
+        file << "P6\n" << width << " " << height << "\n255\n";
+
+        for (int row = y; row < y + height; row++)
+        {
+            for (int col = x; col < x + width; col++)
+            {
+                // the BGR order of the panel and its inversion are compensated by MADCTL and
+                // INVON as on the device, so the memory holds the colors LVGL drew
+                uint16_t pixel = get_shown_pixel(col, row);
+
+                char rgb[3] = { static_cast<char>((((pixel >> 11) & 0x1F) * 255) / 31),
+                                static_cast<char>((((pixel >> 5) & 0x3F) * 255) / 63),
+                                static_cast<char>(((pixel & 0x1F) * 255) / 31) };
+
+                file.write(rgb, sizeof(rgb));
+            }
+        }
+
+        return file.good();
+    }
+
+    // Get the memory row shown on a row of the panel, the start row follows the top fixed rows
+    int SimDisplay::get_scrolled_line(int line) const
+    {
+        int position = line - top_fixed_rows;
+
+        if (!scrolling || scroll_rows <= 0 || position < 0 || position >= scroll_rows)
+        {
+            return line;
+        }
+
+        int start = ((scroll_start - top_fixed_rows) % scroll_rows + scroll_rows) % scroll_rows;
+
+        return top_fixed_rows + (start + position) % scroll_rows;
+    }
+
+    // Get the memory pixel shown at an address, the scroll is along the memory rows
+    uint16_t SimDisplay::get_shown_pixel(int col, int row) const
+    {
+        bool exchanged = (madctl & MADCTL_MV) != 0;
+        bool reversed = (madctl & MADCTL_MY) != 0;
+        int address = exchanged ? col : row;
+        int line = reversed ? MEMORY_SIZE - 1 - address : address;
+        int shown = get_scrolled_line(line);
+        int shown_address = reversed ? MEMORY_SIZE - 1 - shown : shown;
+
+        return exchanged ? memory[row * MEMORY_SIZE + shown_address] : memory[shown_address * MEMORY_SIZE + col];
+    }
+
+    // Keep the bus busy for the time a number of bytes take, called with the guard held
+    void SimDisplay::transfer(size_t bytes)
+    {
+        int64_t now_us = esp_timer_get_time();
+        int64_t start_us = busy_until_us > now_us ? busy_until_us : now_us;
+        busy_until_us = start_us + static_cast<int64_t>(bytes) * 8 * 1000000 / clock_frequency;
+    }
+}
@@ -0,0 +1,147 @@
+/****************************************************************************************
+ * SimDisplay.h - An in-memory ST7735S frame memory that replaces the LCD on the host
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The frame memory of the ST7735S is 132 x 162 pixels.  The host LCDSpi writes the
+//  address window of each send_lines() into it in the (MADCTL rotated) order the
+//  firmware addresses it, so a screenshot taken at the 160x80 green tab offsets shows
+//  exactly what the M5StickC would show.  Pixels arrive as big endian RGB565, the
+//  order LVGL produces with LV_COLOR_16_SWAP, or packed two in three bytes after
+//  COLMOD 0x03.
+//
+//  VSCRDEF and VSCRSADD scroll a band of the 162 memory rows as on the panel, the rows
+//  are the columns when MADCTL exchanges them, and MY reverses their order.  The
+//  screenshot shows the memory through the scroll, NORON ends it.
+//
+//  A transfer keeps the simulated SPI bus busy for the time the bytes take at the
+//  clock frequency of the device, wait_until_idle() sleeps until it is done, so the
+//  flush timing measured on the host follows the device.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace redstone
+{
+    class SimDisplay
+    {
+        public:
+            static constexpr int MEMORY_SIZE = 162;     // both axes, so any MADCTL rotation fits
+
+            /// Get the simulated display
+            static SimDisplay& instance();
+
+            /// Set the SPI clock frequency
+            /// \param frequency The clock frequency in Hz
+            void set_clock_frequency(int frequency)
+            {
+                clock_frequency = frequency;
+            }
+
+            /// A command and its parameters were sent
+            /// \param cmd The command
+            /// \param data The parameters
+            /// \param length The number of parameters
+            void command(uint8_t cmd, const uint8_t* data, size_t length);
+
+            /// Pixel data was sent for an address window
+            /// \param x1 The first column
+            /// \param y1 The first row
+            /// \param x2 The last column
+            /// \param y2 The last row
+            /// \param data The pixel data
+            /// \param length The number of bytes
+            void write_pixels(int x1, int y1, int x2, int y2, const uint8_t* data, size_t length);
+
+            /// Sleep until the last transfer is done
+            void wait_until_idle();
+
+            /// Write a region of the frame memory to a binary PPM file
+            /// \param path The file to write
+            /// \param x The first column
+            /// \param y The first row
+            /// \param width The width of the region
+            /// \param height The height of the region
+            /// \return true on success
+            bool write_ppm(const std::string& path, int x, int y, int width, int height);
+
+            /// Number of bytes of pixel data sent
+            uint64_t get_pixel_bytes() const
+            {
+                return pixel_bytes;
+            }
+
+            /// Number of send_lines() transfers
+            uint32_t get_transfers() const
+            {
+                return transfers;
+            }
+
+            /// The last MADCTL value sent
+            uint8_t get_madctl() const
+            {
+                return madctl;
+            }
+
+            /// The last COLMOD value sent
+            uint8_t get_colmod() const
+            {
+                return colmod;
+            }
+
+            /// Is the display inversion on
+            bool is_inverted() const
+            {
+                return inverted;
+            }
+
+            /// Is the display scrolling
+            bool is_scrolling() const
+            {
+                return scrolling;
+            }
+
+        private:
+            /// Keep the bus busy for the time a number of bytes take
+            void transfer(size_t bytes);
+
+            /// Get the memory row shown on a row of the panel
+            /// \param line The row of the panel, in the order of the memory rows
+            int get_scrolled_line(int line) const;
+
+            /// Get the memory pixel shown at an address, called with the guard held
+            uint16_t get_shown_pixel(int col, int row) const;
+
+            std::vector<uint16_t> memory = std::vector<uint16_t>(MEMORY_SIZE * MEMORY_SIZE, 0);
+            std::mutex guard{};
+            int clock_frequency{ 26 * 1000 * 1000 };
+            int64_t busy_until_us{ 0 };
+            uint8_t madctl{ 0 };
+            uint8_t colmod{ 0x05 };
+            bool inverted{ false };
+            bool scrolling{ false };
+            int top_fixed_rows{ 0 };
+            int scroll_rows{ MEMORY_SIZE };
+            int scroll_start{ 0 };
+            std::atomic<uint64_t> pixel_bytes{ 0 };
+            std::atomic<uint32_t> transfers{ 0 };
+    };
+}
@@ -0,0 +1,200 @@
+/****************************************************************************************
+ * SimFlash.cpp - The raw data partitions of the flash, on the host
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Each partition is a file <label>.bin in the working directory, created erased, that
+//  is memory mapped shared so its contents survive the process like the flash survives
+//  a reset.  The NOR flash rules are kept: an erase is of whole 4kB sectors and sets
+//  every bit, a write can only clear bits.
+/////////////////////////////////////////////////////////////////////////////////////////
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <esp_partition.h>
+
+namespace
+{
+    constexpr size_t SECTOR_SIZE = 4096;
+
+    struct SimPartition
+    {
+        esp_partition_t partition;
+        uint8_t* data;
+    };
+
+    // The raw data partitions of partitions.csv
+    SimPartition partitions[] = {
+        { { ESP_PARTITION_TYPE_DATA, static_cast<esp_partition_subtype_t>(0x40), 0x394000, 256 * 1024,
+            "sample_log", false }, nullptr },
+        { { ESP_PARTITION_TYPE_DATA, static_cast<esp_partition_subtype_t>(0x40), 0x3D4000, 64 * 1024,
+            "sample_bench", false }, nullptr }
+    };
+
+    std::mutex guard;
+
+    // Map the file of a partition, erasing a new file
+    uint8_t* map_partition(SimPartition& sim)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+
+        if (sim.data == nullptr)
+        {
+            std::string path = std::string(sim.partition.label) + ".bin";
+            int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            struct stat st{};
+
+            if (fd >= 0 && fstat(fd, &st) == 0)
+            {
+                bool is_new = static_cast<size_t>(st.st_size) != sim.partition.size;
+
+                if (!is_new || ftruncate(fd, sim.partition.size) == 0)
+                {
+                    void* p = mmap(nullptr, sim.partition.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                    sim.data = p != MAP_FAILED ? static_cast<uint8_t*>(p) : nullptr;
+                }
+
+                if (sim.data != nullptr && is_new)
+                {
+                    memset(sim.data, 0xFF, sim.partition.size);
+                }
+            }
+
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+
+        return sim.data;
+    }
+
+    SimPartition* find(const esp_partition_t* partition)
+    {
+        SimPartition* res = nullptr;
+
+        for (auto& sim : partitions)
+        {
+            res = &sim.partition == partition ? &sim : res;
+        }
+
+        return res != nullptr && map_partition(*res) != nullptr ? res : nullptr;
+    }
+
+    bool in_range(const SimPartition* sim, size_t offset, size_t size)
+    {
+        return sim != nullptr && offset <= sim->partition.size && size <= sim->partition.size - offset;
+    }
+}
+
+extern "C" const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                           const char* label)
+{
+    const esp_partition_t* res = nullptr;
+
+    for (auto& sim : partitions)
+    {
+        if (res == nullptr
+            && sim.partition.type == type
+            && (subtype == ESP_PARTITION_SUBTYPE_ANY || sim.partition.subtype == subtype)
+            && (label == nullptr || strcmp(sim.partition.label, label) == 0))
+        {
+            res = &sim.partition;
+        }
+    }
+
+    return res;
+}
+
+extern "C" esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size)
+{
+    SimPartition* sim = find(partition);
+
+    if (!in_range(sim, src_offset, size))
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    memcpy(dst, sim->data + src_offset, size);
+
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_partition_write(const esp_partition_t* partition, size_t dst_offset, const void* src,
+                                         size_t size)
+{
+    SimPartition* sim = find(partition);
+
+    if (!in_range(sim, dst_offset, size))
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // Programming only clears bits
+    auto bytes = static_cast<const uint8_t*>(src);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        sim->data[dst_offset + i] &= bytes[i];
+    }
+
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size)
+{
+    SimPartition* sim = find(partition);
+
+    if (!in_range(sim, offset, size))
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    if (offset % SECTOR_SIZE != 0 || size % SECTOR_SIZE != 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(sim->data + offset, 0xFF, size);
+
+    return ESP_OK;
+}
+
+extern "C" esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size,
+                                        esp_partition_mmap_memory_t /*memory*/, const void** out_ptr,
+                                        spi_flash_mmap_handle_t* out_handle)
+{
+    SimPartition* sim = find(partition);
+
+    if (!in_range(sim, offset, size))
+    {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    *out_ptr = sim->data + offset;
+    *out_handle = 0;
+
+    return ESP_OK;
+}
+
+extern "C" void spi_flash_munmap(spi_flash_mmap_handle_t /*handle*/)
+{
+    // The partitions stay mapped for the life of the process
+}
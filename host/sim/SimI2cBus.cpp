@@ -0,0 +1,118 @@
+/****************************************************************************************
+ * SimI2cBus.cpp - A simulated I2C bus that the host build I2C master devices talk to
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "sim/SimI2cBus.h"
+#include <array>
+#include <chrono>
+#include <thread>
+#include <esp_timer.h>
+
+using namespace std::chrono;
+
+namespace redstone
+{
+    // Class constants
+    static constexpr int64_t BITS_PER_BYTE = 9;            // 8 data bits and the ACK
+    static constexpr int64_t START_STOP_BITS = 2;
+
+    // Get the bus of an I2C port
+    SimI2cBus& SimI2cBus::instance(i2c_port_t port)
+    {
+        static std::array<SimI2cBus, I2C_NUM_MAX> buses{};
+
+        return buses[port];
+    }
+
+    // Attach a device to the bus
+    void SimI2cBus::attach(SimI2cDevice& device)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        devices[device.get_address()] = &device;
+    }
+
+    // Find the device at an address
+    SimI2cDevice* SimI2cBus::find(uint8_t address)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto it = devices.find(address);
+
+        return it == devices.end() ? nullptr : it->second;
+    }
+
+    // Address a device without transferring data
+    bool SimI2cBus::probe(uint8_t address)
+    {
+        SimI2cDevice* device = find(address);
+        bool ack = device != nullptr && device->acknowledge(esp_timer_get_time());
+        transfer(1, ack ? device : nullptr);
+
+        return ack;
+    }
+
+    // Write the register address then read registers with a repeated start
+    bool SimI2cBus::read(uint8_t address, uint8_t reg, uint8_t* data, size_t length)
+    {
+        SimI2cDevice* device = find(address);
+        bool ack = device != nullptr && device->acknowledge(esp_timer_get_time());
+
+        if (ack)
+        {
+            // address + register, repeated start, address + data
+            transfer(3 + length, device);
+            device->read(reg, data, length, esp_timer_get_time());
+        }
+        else
+        {
+            transfer(1, nullptr);
+        }
+
+        return ack;
+    }
+
+    // Write data, the first byte is the register address
+    bool SimI2cBus::write(uint8_t address, const std::vector<uint8_t>& data)
+    {
+        SimI2cDevice* device = find(address);
+        bool ack = device != nullptr && device->acknowledge(esp_timer_get_time());
+
+        if (ack)
+        {
+            transfer(1 + data.size(), device);
+
+            if (!data.empty())
+            {
+                device->write(data[0], data.data() + 1, data.size() - 1, esp_timer_get_time());
+            }
+        }
+        else
+        {
+            transfer(1, nullptr);
+        }
+
+        return ack;
+    }
+
+    // Wait for the time a transaction takes
+    void SimI2cBus::transfer(size_t bytes, const SimI2cDevice* device)
+    {
+        int64_t wire_us = (static_cast<int64_t>(bytes) * BITS_PER_BYTE + START_STOP_BITS) * 1000000 / clock_frequency;
+        int64_t duration_us = wire_us + (device != nullptr ? device->get_latency_us() : 0);
+
+        std::this_thread::sleep_for(microseconds(duration_us));
+        transactions += 1;
+        busy_us += duration_us;
+    }
+}
@@ -0,0 +1,103 @@
+/****************************************************************************************
+ * SimI2cBus.h - A simulated I2C bus that the host build I2C master devices talk to
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  A transaction takes the time the bytes need on the wire at the clock frequency of
+//  the bus (9 bit times per byte, address and register bytes included) plus the latency
+//  of the device, and the calling thread sleeps for that long.  Timing measured on the
+//  host is then close to the timing on the device, which is what makes the benchmarks
+//  of the I2C changes meaningful on a Linux box.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+#include <driver/i2c.h>
+#include "sim/SimI2cDevice.h"
+
+namespace redstone
+{
+    class SimI2cBus
+    {
+        public:
+            /// Get the bus of an I2C port
+            /// \param port The I2C port
+            static SimI2cBus& instance(i2c_port_t port);
+
+            /// Attach a device to the bus
+            /// \param device The device, must outlive the bus
+            void attach(SimI2cDevice& device);
+
+            /// Find the device at an address
+            /// \param address The I2C address
+            /// \return The device or nullptr
+            SimI2cDevice* find(uint8_t address);
+
+            /// Set the clock frequency of the bus, done by the I2C master
+            /// \param frequency The clock frequency in Hz
+            void set_clock_frequency(int frequency)
+            {
+                clock_frequency = frequency;
+            }
+
+            /// Address a device without transferring data
+            /// \param address The I2C address
+            /// \return true if the device acknowledged
+            bool probe(uint8_t address);
+
+            /// Write the register address then read registers with a repeated start
+            /// \param address The I2C address
+            /// \param reg The first register
+            /// \param data The buffer to fill in
+            /// \param length The number of registers to read
+            /// \return true if the device acknowledged
+            bool read(uint8_t address, uint8_t reg, uint8_t* data, size_t length);
+
+            /// Write data, the first byte is the register address
+            /// \param address The I2C address
+            /// \param data The register address followed by the values
+            /// \return true if the device acknowledged
+            bool write(uint8_t address, const std::vector<uint8_t>& data);
+
+            /// Number of transactions performed on the bus
+            uint32_t get_transactions() const
+            {
+                return transactions;
+            }
+
+            /// Time the bus has been busy in microseconds
+            int64_t get_busy_us() const
+            {
+                return busy_us;
+            }
+
+        private:
+            /// Wait for the time a transaction takes
+            /// \param bytes The number of bytes on the wire
+            /// \param device The device addressed, nullptr if nobody answered
+            void transfer(size_t bytes, const SimI2cDevice* device);
+
+            std::map<uint8_t, SimI2cDevice*> devices{};
+            std::mutex guard{};
+            int clock_frequency{ 100 * 1000 };
+            std::atomic<uint32_t> transactions{ 0 };
+            std::atomic<int64_t> busy_us{ 0 };
+    };
+}
@@ -0,0 +1,133 @@
+/****************************************************************************************
+ * SimI2cDevice.cpp - The base of the simulated I2C devices used by the host build
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "sim/SimI2cDevice.h"
+
+namespace redstone
+{
+    // Constructor
+    SimI2cDevice::SimI2cDevice(const char* name, uint8_t address) : name(name), address(address)
+    {
+    }
+
+    // Set a parameter of the device
+    bool SimI2cDevice::set_parameter(const std::string& parameter, float value)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        bool res = true;
+
+        if (parameter == "latency_us")
+        {
+            latency_us = static_cast<int64_t>(value);
+        }
+        else if (parameter == "noise")
+        {
+            noise = value;
+        }
+        else if (parameter == "nak_probability")
+        {
+            nak_probability = value;
+        }
+        else if (parameter == "fail_next")
+        {
+            fail_next = static_cast<uint32_t>(value);
+        }
+        else if (parameter == "present")
+        {
+            present = value != 0.0f;
+        }
+        else
+        {
+            res = false;
+        }
+
+        return res;
+    }
+
+    // Address the device
+    bool SimI2cDevice::acknowledge(int64_t /*now_us*/)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        bool ack = present;
+
+        if (ack && fail_next > 0)
+        {
+            fail_next -= 1;
+            injected_faults += 1;
+            ack = false;
+        }
+        else if (ack && nak_probability > 0.0f)
+        {
+            std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+
+            if (chance(random) < nak_probability)
+            {
+                injected_faults += 1;
+                ack = false;
+            }
+        }
+
+        return ack;
+    }
+
+    // Read registers
+    void SimI2cDevice::read(uint8_t reg, uint8_t* data, size_t length, int64_t now_us)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        update(now_us);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            data[i] = registers[static_cast<uint8_t>(reg + i)];
+        }
+    }
+
+    // Write registers
+    void SimI2cDevice::write(uint8_t reg, const uint8_t* data, size_t length, int64_t now_us)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            register_written(static_cast<uint8_t>(reg + i), data[i], now_us);
+        }
+    }
+
+    // Bring the registers up to date, the registers of the base class never change by themselves
+    void SimI2cDevice::update(int64_t /*now_us*/)
+    {
+    }
+
+    // A register was written
+    void SimI2cDevice::register_written(uint8_t reg, uint8_t value, int64_t /*now_us*/)
+    {
+        registers[reg] = value;
+    }
+
+    // Add the configured noise to a value, called with the guard held
+    float SimI2cDevice::with_noise(float value)
+    {
+        float res = value;
+
+        if (noise > 0.0f)
+        {
+            std::normal_distribution<float> distribution(0.0f, noise);
+            res = value * (1.0f + distribution(random));
+        }
+
+        return res;
+    }
+}
@@ -0,0 +1,130 @@
+/****************************************************************************************
+ * SimI2cDevice.h - The base of the simulated I2C devices used by the host build
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  A simulated device is a 256 byte register file behind an I2C address.  A read starts
+//  at a register and auto-increments like the real parts do.  Every device has the same
+//  set of parameters that can be changed from the command line of the host build:
+//
+//      latency_us          extra time a transaction takes, on top of the bus wire time
+//      noise               standard deviation of the measurement noise, relative to the
+//                          value (0.01 = 1%)
+//      nak_probability     probability a transaction is not acknowledged
+//      fail_next           the next N transactions are not acknowledged
+//      present             0 = the device does not answer at all
+//
+//  The device models add their own parameters, the values they measure.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+
+namespace redstone
+{
+    class SimI2cDevice
+    {
+        public:
+            /// Constructor
+            /// \param name The name used for the command line parameters
+            /// \param address The I2C address of the device
+            SimI2cDevice(const char* name, uint8_t address);
+
+            virtual ~SimI2cDevice() = default;
+
+            /// Get the name of the device
+            const char* get_name() const
+            {
+                return name;
+            }
+
+            /// Get the I2C address of the device
+            uint8_t get_address() const
+            {
+                return address;
+            }
+
+            /// Get the extra latency of a transaction in microseconds
+            int64_t get_latency_us() const
+            {
+                return latency_us;
+            }
+
+            /// Set a parameter of the device
+            /// \param parameter The name of the parameter
+            /// \param value The new value
+            /// \return true if the parameter exists
+            virtual bool set_parameter(const std::string& parameter, float value);
+
+            /// Address the device, answers with an ACK if the transaction is not faulted
+            /// \param now_us The simulated time in microseconds
+            bool acknowledge(int64_t now_us);
+
+            /// Read registers, auto-incrementing from the start register
+            /// \param reg The first register
+            /// \param data The buffer to fill in
+            /// \param length The number of registers to read
+            /// \param now_us The simulated time in microseconds
+            void read(uint8_t reg, uint8_t* data, size_t length, int64_t now_us);
+
+            /// Write registers, auto-incrementing from the start register
+            /// \param reg The first register
+            /// \param data The values to write
+            /// \param length The number of registers to write
+            /// \param now_us The simulated time in microseconds
+            void write(uint8_t reg, const uint8_t* data, size_t length, int64_t now_us);
+
+            /// Number of transactions that were not acknowledged because of a fault
+            uint32_t get_injected_faults() const
+            {
+                return injected_faults;
+            }
+
+        protected:
+            /// Bring the registers up to date before they are read
+            /// \param now_us The simulated time in microseconds
+            virtual void update(int64_t now_us);
+
+            /// A register was written
+            /// \param reg The register
+            /// \param value The value written
+            /// \param now_us The simulated time in microseconds
+            virtual void register_written(uint8_t reg, uint8_t value, int64_t now_us);
+
+            /// Add the configured noise to a value
+            /// \param value The value without noise
+            float with_noise(float value);
+
+            std::array<uint8_t, 256> registers{};
+            std::mutex guard{};
+
+        private:
+            const char* name;
+            uint8_t address;
+            int64_t latency_us{ 0 };
+            float noise{ 0.0f };
+            float nak_probability{ 0.0f };
+            uint32_t fail_next{ 0 };
+            bool present{ true };
+            uint32_t injected_faults{ 0 };
+
+            std::mt19937 random{ 5489u };
+    };
+}
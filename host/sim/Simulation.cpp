@@ -0,0 +1,103 @@
+/****************************************************************************************
+ * Simulation.cpp - The simulated M5StickC and Envir HAT peripherals of the host build
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "sim/Simulation.h"
+#include <cstdlib>
+#include <smooth/core/logging/log.h>
+#include "sim/SimDisplay.h"
+#include "sim/SimI2cBus.h"
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "Simulation";
+
+    // Get the simulation
+    Simulation& Simulation::instance()
+    {
+        static Simulation simulation;
+
+        return simulation;
+    }
+
+    // Constructor
+    Simulation::Simulation()
+    {
+        SimI2cBus::instance(I2C_NUM_0).attach(axp192);
+        SimI2cBus::instance(I2C_NUM_0).attach(bm8563);
+        SimI2cBus::instance(I2C_NUM_1).attach(dht12);
+        SimI2cBus::instance(I2C_NUM_1).attach(bmp280);
+    }
+
+    // Set a device parameter
+    bool Simulation::set_parameter(const std::string& assignment)
+    {
+        auto dot = assignment.find('.');
+        auto equal = assignment.find('=');
+        bool res = false;
+
+        if (dot != std::string::npos && equal != std::string::npos && dot < equal)
+        {
+            std::string device = assignment.substr(0, dot);
+            std::string parameter = assignment.substr(dot + 1, equal - dot - 1);
+            char* end = nullptr;
+            std::string text = assignment.substr(equal + 1);
+            float value = std::strtof(text.c_str(), &end);
+
+            for (SimI2cDevice* model : { static_cast<SimI2cDevice*>(&axp192),
+                                         static_cast<SimI2cDevice*>(&bm8563),
+                                         static_cast<SimI2cDevice*>(&dht12),
+                                         static_cast<SimI2cDevice*>(&bmp280) })
+            {
+                if (device == model->get_name() && end != text.c_str() && *end == '\0')
+                {
+                    res = model->set_parameter(parameter, value);
+                }
+            }
+        }
+
+        if (!res)
+        {
+            Log::error(TAG, "Unknown simulation parameter: {}", assignment);
+        }
+
+        return res;
+    }
+
+    // Print the transactions, bus time and injected faults
+    void Simulation::print_statistics()
+    {
+        for (auto port : { I2C_NUM_0, I2C_NUM_1 })
+        {
+            SimI2cBus& bus = SimI2cBus::instance(port);
+            Log::info(TAG, "i2c{}: transactions={} busy={}us",
+                      static_cast<int>(port), bus.get_transactions(), bus.get_busy_us());
+        }
+
+        for (SimI2cDevice* model : { static_cast<SimI2cDevice*>(&axp192),
+                                     static_cast<SimI2cDevice*>(&bm8563),
+                                     static_cast<SimI2cDevice*>(&dht12),
+                                     static_cast<SimI2cDevice*>(&bmp280) })
+        {
+            Log::info(TAG, "{}: injected faults={}", model->get_name(), model->get_injected_faults());
+        }
+
+        SimDisplay& display = SimDisplay::instance();
+        Log::info(TAG, "display: transfers={} pixel bytes={}", display.get_transfers(), display.get_pixel_bytes());
+    }
+}
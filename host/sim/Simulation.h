@@ -0,0 +1,60 @@
+/****************************************************************************************
+ * Simulation.h - The simulated M5StickC and Envir HAT peripherals of the host build
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The device models are attached to the buses they are on in the M5StickC:
+//
+//      i2c0 (internal)     AXP192 0x34, BM8563 0x51
+//      i2c1 (Envir HAT)    DHT12 0x5C, BMP280 0x76
+//
+//  A parameter is set with "<device>.<parameter>=<value>", for example
+//  "dht12.latency_us=1500" or "bmp280.nak_probability=0.05".
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <string>
+#include "sim/Axp192Model.h"
+#include "sim/Bm8563Model.h"
+#include "sim/Bmp280Model.h"
+#include "sim/Dht12Model.h"
+
+namespace redstone
+{
+    class Simulation
+    {
+        public:
+            /// Get the simulation, the models are attached on first use
+            static Simulation& instance();
+
+            /// Set a device parameter
+            /// \param assignment The parameter as "<device>.<parameter>=<value>"
+            /// \return true if the device and parameter exist
+            bool set_parameter(const std::string& assignment);
+
+            /// Print the transactions, bus time and injected faults
+            void print_statistics();
+
+        private:
+            /// Constructor
+            Simulation();
+
+            Axp192Model axp192{};
+            Bm8563Model bm8563{};
+            Dht12Model dht12{};
+            Bmp280Model bmp280{};
+    };
+}
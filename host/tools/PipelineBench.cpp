@@ -0,0 +1,143 @@
+/****************************************************************************************
+ * PipelineBench.cpp - Measures the overlap of the SamplePipeline stages
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Runs a sample set of the SensorTask, a BMP280 forced conversion on i2c1 as a split
+//  stage and an AXP192 read on i2c0 as a single stage, with stages that sleep for the
+//  simulated device latencies.  Each set is run through the SamplePipeline and then
+//  serially, start, wait for the conversion, collect, then the AXP192 read, and the
+//  average wall time of both is reported:
+//
+//      PipelineBench [--rounds <n>] [--start-us <n>] [--conversion-us <n>]
+//                    [--collect-us <n>] [--single-us <n>]
+//
+//  The defaults are the BMP280 at 16x pressure oversampling and a full AXP192 read.
+/////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include "model/I2cBusQueue.h"
+#include "model/SamplePipeline.h"
+
+using namespace redstone;
+using namespace std::chrono;
+
+namespace
+{
+    int64_t now_us()
+    {
+        return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    void sleep_us(int64_t us)
+    {
+        std::this_thread::sleep_for(microseconds(us));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int rounds = 200;
+    int64_t start_latency_us = 300;
+    int64_t conversion_us = 6400;
+    int64_t collect_latency_us = 500;
+    int64_t single_latency_us = 1500;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+
+        if (std::strcmp(argv[i], "--rounds") == 0 && has_value)
+        {
+            rounds = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (std::strcmp(argv[i], "--start-us") == 0 && has_value)
+        {
+            start_latency_us = std::atoll(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--conversion-us") == 0 && has_value)
+        {
+            conversion_us = std::atoll(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--collect-us") == 0 && has_value)
+        {
+            collect_latency_us = std::atoll(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--single-us") == 0 && has_value)
+        {
+            single_latency_us = std::atoll(argv[++i]);
+        }
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--rounds <n>] [--start-us <n>] [--conversion-us <n>]"
+                                 " [--collect-us <n>] [--single-us <n>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    auto start = [&]() {
+                     sleep_us(start_latency_us);
+                     return conversion_us;
+                 };
+    auto collect = [&]() {
+                       sleep_us(collect_latency_us);
+                       return true;
+                   };
+    auto single = [&]() {
+                      sleep_us(single_latency_us);
+                      return true;
+                  };
+
+    I2cBusQueue i2c0("i2c0", 4);
+    I2cBusQueue i2c1("i2c1", 4);
+    SamplePipeline pipeline(now_us, sleep_us);
+    pipeline.add_split_stage("BMP280", i2c1, start, collect, nullptr);
+    pipeline.add_stage("AXP192", i2c0, single, nullptr);
+
+    int64_t overlapped_us = 0;
+    int64_t estimate_us = 0;
+
+    for (int round = 0; round < rounds; round++)
+    {
+        pipeline.run();
+        overlapped_us += pipeline.get_last_wall_us();
+        estimate_us += pipeline.get_last_serial_us();
+    }
+
+    int64_t serial_us = 0;
+
+    for (int round = 0; round < rounds; round++)
+    {
+        int64_t begin_us = now_us();
+        sleep_us(start());
+        collect();
+        single();
+        serial_us += now_us() - begin_us;
+    }
+
+    std::printf("Sample set of a %lld us conversion (%lld us start, %lld us collect) and a %lld us read, %d rounds\n",
+                static_cast<long long>(conversion_us), static_cast<long long>(start_latency_us),
+                static_cast<long long>(collect_latency_us), static_cast<long long>(single_latency_us), rounds);
+    std::printf("  overlapped  %8.1f us\n", static_cast<double>(overlapped_us) / rounds);
+    std::printf("  serial      %8.1f us (pipeline estimate %.1f us)\n", static_cast<double>(serial_us) / rounds,
+                static_cast<double>(estimate_us) / rounds);
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+/****************************************************************************************
+ * Rgb444Bench.cpp - Measures the RGB444 packer of the display flush
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Packs a display buffer of random pixels, 160 x 40 as the DisplayDriver flushes it,
+//  with pack_rgb444() and with a reference that writes one 4 bit color at a time, checks
+//  that they agree, also on odd pixel counts, and reports the time per pixel of each
+//  against the SPI time the packing saves.
+//
+//      Rgb444Bench [--rounds <n>]
+/////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "gui/Rgb444Packer.h"
+
+using namespace redstone;
+using namespace std::chrono;
+
+namespace
+{
+    constexpr size_t BUFFER_PIXELS = 160 * 40;
+    constexpr size_t FRAME_PIXELS = 160 * 80;
+    constexpr double SPI_CLOCK_HZ = 26.67e6;
+
+    // Pack one 4 bit color at a time, the layout the ST7735S datasheet gives for COLMOD 0x03
+    size_t pack_reference(const uint8_t* in, uint8_t* out, size_t pixels)
+    {
+        size_t nibble = 0;
+
+        auto put = [&](uint32_t value) {
+            if (nibble % 2 == 0)
+            {
+                out[nibble / 2] = static_cast<uint8_t>(value << 4);
+            }
+            else
+            {
+                out[nibble / 2] |= static_cast<uint8_t>(value);
+            }
+
+            nibble += 1;
+        };
+
+        for (size_t i = 0; i < pixels; i++)
+        {
+            uint32_t pixel = (static_cast<uint32_t>(in[2 * i]) << 8) | in[2 * i + 1];
+            put((pixel >> 12) & 0x0F);      // red, 5 bits
+            put((pixel >> 7) & 0x0F);       // green, 6 bits
+            put((pixel >> 1) & 0x0F);       // blue, 5 bits
+        }
+
+        return (nibble + 1) / 2;
+    }
+
+    // Time a packer over the rounds, the copy of the pixels into the buffer included
+    template<typename Pack>
+    double time_ns_per_pixel(const std::vector<uint8_t>& pixels, std::vector<uint8_t>& buffer, int rounds, Pack pack)
+    {
+        auto start = steady_clock::now();
+        volatile uint8_t sink = 0;
+
+        for (int round = 0; round < rounds; round++)
+        {
+            std::memcpy(buffer.data(), pixels.data(), pixels.size());
+            pack(buffer.data());
+            sink = sink + buffer[round % buffer.size()];
+        }
+
+        double ns = static_cast<double>(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+
+        return ns / (static_cast<double>(rounds) * BUFFER_PIXELS);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int rounds = 20000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--rounds") == 0 && i + 1 < argc)
+        {
+            rounds = std::max(1, std::atoi(argv[++i]));
+        }
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--rounds <n>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::mt19937 random(17);
+    std::vector<uint8_t> pixels(BUFFER_PIXELS * 2);
+
+    for (auto& byte : pixels)
+    {
+        byte = static_cast<uint8_t>(random());
+    }
+
+    // The packer and the reference agree, on odd pixel counts too
+    std::vector<uint8_t> packed(pixels.size());
+    std::vector<uint8_t> reference(pixels.size());
+
+    for (size_t count : { BUFFER_PIXELS, BUFFER_PIXELS - 1, size_t{ 1 }, size_t{ 2 }, size_t{ 3 }, size_t{ 161 } })
+    {
+        std::memcpy(packed.data(), pixels.data(), count * 2);
+        size_t size = pack_rgb444(packed.data(), count);
+        pack_reference(pixels.data(), reference.data(), count);
+
+        if (size != get_rgb444_size(count) || std::memcmp(packed.data(), reference.data(), size) != 0)
+        {
+            std::fprintf(stderr, "pack_rgb444() differs from the reference on %zu pixels\n", count);
+            return 1;
+        }
+    }
+
+    std::vector<uint8_t> buffer(pixels.size());
+    double copy_ns = time_ns_per_pixel(pixels, buffer, rounds, [](uint8_t*) {});
+    double kernel_ns = time_ns_per_pixel(pixels, buffer, rounds, [](uint8_t* data) {
+        pack_rgb444(data, BUFFER_PIXELS);
+    });
+    double reference_ns = time_ns_per_pixel(pixels, buffer, rounds, [&reference](uint8_t* data) {
+        pack_reference(data, reference.data(), BUFFER_PIXELS);
+    });
+
+    double spi_ns_16 = 2.0 * 8 * 1e9 / SPI_CLOCK_HZ;
+    double spi_ns_12 = 1.5 * 8 * 1e9 / SPI_CLOCK_HZ;
+
+    std::printf("RGB444 packing of %zu pixel buffers, %d rounds\n", BUFFER_PIXELS, rounds);
+    std::printf("  pack_rgb444  %6.3f ns/pixel\n", kernel_ns - copy_ns);
+    std::printf("  reference    %6.3f ns/pixel\n", reference_ns - copy_ns);
+    std::printf("  SPI at %.2f MHz: %.1f ns/pixel at 16 bit, %.1f ns/pixel at 12 bit\n",
+                SPI_CLOCK_HZ / 1e6, spi_ns_16, spi_ns_12);
+    std::printf("  160x80 frame: %zu B instead of %zu B, %.2f ms instead of %.2f ms on the bus\n",
+                get_rgb444_size(FRAME_PIXELS), FRAME_PIXELS * 2,
+                spi_ns_12 * FRAME_PIXELS / 1e6, spi_ns_16 * FRAME_PIXELS / 1e6);
+
+    return 0;
+}
@@ -0,0 +1,241 @@
+/****************************************************************************************
+ * SampleCodecReport.cpp - Reports the compression of the sample log on recorded traces
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The sensor traces, console logs of TRACE lines or binary traces, are turned into the
+//  10 second samples the SampleLogger takes, holding the latest value of every field as
+//  the TimeSeriesStore does.  The traces are concatenated, each one continuing in time
+//  after the one before.  Without a trace a week of samples is synthesized: daily
+//  cycles, weather fronts and noise at the resolution of each sensor.
+//
+//      SampleCodecReport [--days <n>] [<trace>...]
+//
+//  The samples are coded into SampleLogBlocks, decoded again and checked, and the
+//  report gives the size against 4 byte floats and against the 20 byte fixed point
+//  records the log used before, and the encode and decode time per sample.
+/////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+#include "model/SampleLog.h"
+#include "model/SensorTrace.h"
+#include "replay/TraceFile.h"
+
+using namespace redstone;
+using namespace std::chrono;
+
+namespace
+{
+    constexpr uint32_t SAMPLE_PERIOD_S = 10;
+    constexpr size_t FLOAT_RECORD_SIZE = 4 + TimeSeriesStore::FIELD_COUNT * 4;
+    constexpr size_t FIXED_RECORD_SIZE = 20;
+    constexpr double PI = 3.14159265358979;
+
+    // The resolution of each field, to check the decoded values against
+    constexpr float resolutions[TimeSeriesStore::FIELD_COUNT] = { 0.01f, 0.01f, 0.02f, 0.01f,
+                                                                  0.001f, 0.1f, 0.001f, 0.01f };
+
+    void set(SampleRecord& record, SeriesField field, float value)
+    {
+        record.values[static_cast<size_t>(field)] = value;
+    }
+
+    // Turn a trace into 10 second samples, starting at start_s
+    uint32_t add_trace(const std::vector<uint8_t>& trace, uint32_t start_s, std::vector<SampleRecord>& samples)
+    {
+        SensorTraceReader reader(trace.data(), trace.size());
+        SensorTraceRecord trace_record{};
+        SampleRecord latest{};
+        latest.values.fill(std::numeric_limits<float>::quiet_NaN());
+        uint32_t next_s = start_s;
+
+        while (reader.next(trace_record))
+        {
+            auto time_s = static_cast<uint32_t>(start_s + trace_record.time_ms / 1000);
+
+            while (time_s >= next_s + SAMPLE_PERIOD_S)
+            {
+                latest.time_s = next_s;
+                samples.push_back(latest);
+                next_s += SAMPLE_PERIOD_S;
+            }
+
+            if (trace_record.type == SensorTraceRecordType::Envir)
+            {
+                const EnvirValue& value = trace_record.envir_value;
+                set(latest, SeriesField::Temperature, value.get_temperature_degree_C());
+                set(latest, SeriesField::Humidity, value.get_relative_humidity());
+                set(latest, SeriesField::Pressure, value.get_pressure_hPa());
+                set(latest, SeriesField::Bmp280Temperature, value.get_bmp280_temperature_degree_C());
+            }
+            else
+            {
+                const AxpValue& value = trace_record.axp_value;
+                set(latest, SeriesField::BatteryVoltage, value.get_battery_voltage());
+                set(latest, SeriesField::BatteryCurrent,
+                    value.get_battery_charging_current() - value.get_battery_discharging_current());
+                set(latest, SeriesField::VbusVoltage, value.get_vbus_voltage());
+                set(latest, SeriesField::AxpTemperature, value.get_axp_device_temperature());
+            }
+        }
+
+        return next_s;
+    }
+
+    // Quantize a value to the resolution of its sensor
+    float quantize(double value, double step)
+    {
+        return static_cast<float>(std::round(value / step) * step);
+    }
+
+    // Synthesize days of samples
+    void add_synthetic(int days, std::vector<SampleRecord>& samples)
+    {
+        std::mt19937 random(1);
+        std::normal_distribution<double> noise(0.0, 1.0);
+        double battery = 4.1;
+
+        for (uint32_t time_s = 0; time_s < static_cast<uint32_t>(days) * 86400; time_s += SAMPLE_PERIOD_S)
+        {
+            double day = 2 * PI * time_s / 86400.0;
+            double front = 2 * PI * time_s / (3.5 * 86400.0);
+            double temperature = 21.0 + 3.0 * std::sin(day) + 0.05 * noise(random);
+            bool charging = std::fmod(time_s / 3600.0, 24.0) < 2.0;
+            battery = std::min(4.15, std::max(3.3, battery + (charging ? 0.0004 : -0.00002)));
+
+            SampleRecord record{};
+            record.time_s = time_s;
+            set(record, SeriesField::Temperature, quantize(temperature, 0.1));
+            set(record, SeriesField::Humidity, quantize(45.0 - 8.0 * std::sin(day) + 0.2 * noise(random), 0.1));
+            set(record, SeriesField::Pressure, quantize(920.0 + 6.0 * std::sin(front) + 0.03 * noise(random), 0.01));
+            set(record, SeriesField::Bmp280Temperature, quantize(temperature + 4.5 + 0.01 * noise(random), 0.01));
+            set(record, SeriesField::BatteryVoltage, quantize(battery + 0.002 * noise(random), 0.0011));
+            set(record, SeriesField::BatteryCurrent, quantize((charging ? 80.0 : -45.0) + 2.0 * noise(random), 0.5));
+            set(record, SeriesField::VbusVoltage, charging ? quantize(5.02 + 0.003 * noise(random), 0.0017) : 0.0f);
+            set(record, SeriesField::AxpTemperature, quantize(temperature + 14.0 + 0.2 * noise(random), 0.1));
+            samples.push_back(record);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<SampleRecord> samples;
+    int days = 7;
+    uint32_t start_s = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::vector<uint8_t> trace;
+
+        if (std::strcmp(argv[i], "--days") == 0 && i + 1 < argc)
+        {
+            days = std::atoi(argv[++i]);
+        }
+        else if (TraceFile::load(argv[i], trace))
+        {
+            start_s = add_trace(trace, start_s, samples);
+        }
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--days <n>] [<trace>...]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (samples.empty())
+    {
+        add_synthetic(days, samples);
+    }
+
+    // Encode
+    std::vector<std::vector<uint8_t>> blocks;
+    SampleLogBlock block{};
+    size_t payload_bytes = 0;
+    auto start = steady_clock::now();
+    block.start(1, 1);
+
+    for (const auto& sample : samples)
+    {
+        if (!block.add(sample))
+        {
+            payload_bytes += SampleLogBlock::HEADER_SIZE + block.get_payload_size();
+            const uint8_t* data = block.finish();
+            blocks.emplace_back(data, data + SampleLogBlock::BLOCK_SIZE);
+            block.start(static_cast<uint32_t>(blocks.size() + 1), 1);
+            block.add(sample);
+        }
+    }
+
+    payload_bytes += SampleLogBlock::HEADER_SIZE + block.get_payload_size();
+    const uint8_t* last = block.finish();
+    blocks.emplace_back(last, last + SampleLogBlock::BLOCK_SIZE);
+    double encode_ns = duration_cast<nanoseconds>(steady_clock::now() - start).count() / double(samples.size());
+
+    // Decode and check against the resolution of each field
+    std::vector<SampleRecord> decoded;
+    decoded.reserve(samples.size());
+    start = steady_clock::now();
+
+    for (const auto& data : blocks)
+    {
+        SampleLogBlockReader reader{ data.data() };
+        SampleRecord record{};
+
+        while (reader.next(record))
+        {
+            decoded.push_back(record);
+        }
+    }
+
+    double decode_ns = duration_cast<nanoseconds>(steady_clock::now() - start).count() / double(samples.size());
+    size_t errors = decoded.size() == samples.size() ? 0 : 1;
+
+    for (size_t i = 0; i < std::min(decoded.size(), samples.size()); i++)
+    {
+        errors += decoded[i].time_s != samples[i].time_s ? 1 : 0;
+
+        for (size_t field = 0; field < TimeSeriesStore::FIELD_COUNT; field++)
+        {
+            float a = samples[i].values[field];
+            float b = decoded[i].values[field];
+            bool same = std::isnan(a) ? std::isnan(b) : std::fabs(a - b) <= resolutions[field] * 0.5f + 1e-4f;
+            errors += same ? 0 : 1;
+        }
+    }
+
+    size_t count = samples.size();
+    std::printf("samples             %zu, %.1f days\n", count, count * SAMPLE_PERIOD_S / 86400.0);
+    std::printf("4 byte floats       %zu bytes, %zu per sample\n", count * FLOAT_RECORD_SIZE, FLOAT_RECORD_SIZE);
+    std::printf("fixed point         %zu bytes, %zu per sample\n", count * FIXED_RECORD_SIZE, FIXED_RECORD_SIZE);
+    std::printf("compressed          %zu bytes, %.2f bits per sample\n", payload_bytes, payload_bytes * 8.0 / count);
+    std::printf("ratio               %.2fx against floats, %.2fx against fixed point\n",
+                double(count * FLOAT_RECORD_SIZE) / payload_bytes, double(count * FIXED_RECORD_SIZE) / payload_bytes);
+    std::printf("blocks              %zu, %.0f samples = %.1f hours per full block\n",
+                blocks.size(), double(count) / blocks.size(), double(count) / blocks.size() * SAMPLE_PERIOD_S / 3600);
+    std::printf("encode              %.0f ns per sample\n", encode_ns);
+    std::printf("decode              %.0f ns per sample\n", decode_ns);
+    std::printf("round trip errors   %zu\n", errors);
+
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+/****************************************************************************************
+ * SampleLogReader.cpp - Prints the sample log files of the app_storage partition as CSV
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Reads the image of the sample_log partition, or the samples0.bin and samples1.bin
+//  files of the FAT store, copied from the device or written by the host build, and
+//  prints the records of all valid blocks in sequence order:
+//
+//      SampleLogReader sample_log.bin > samples.csv
+//      SampleLogReader app_storage/samples0.bin app_storage/samples1.bin > samples.csv
+//
+//  The blocks that are not valid, erased sectors and torn writes, are skipped.
+/////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "model/SampleLog.h"
+
+using namespace redstone;
+
+namespace
+{
+    using Block = std::vector<uint8_t>;
+
+    void read_blocks(const char* path, std::vector<Block>& blocks)
+    {
+        FILE* f = std::fopen(path, "rb");
+
+        if (f == nullptr)
+        {
+            std::fprintf(stderr, "can't open %s\n", path);
+            return;
+        }
+
+        Block data(SampleLogBlock::BLOCK_SIZE);
+        size_t valid = 0;
+
+        while (std::fread(data.data(), 1, data.size(), f) == data.size())
+        {
+            if (SampleLogBlock::is_valid(data.data()))
+            {
+                blocks.push_back(data);
+                valid += 1;
+            }
+        }
+
+        std::fclose(f);
+        std::fprintf(stderr, "%s: %zu blocks\n", path, valid);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: %s <samples.bin>...\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<Block> blocks;
+
+    for (int i = 1; i < argc; i++)
+    {
+        read_blocks(argv[i], blocks);
+    }
+
+    std::sort(blocks.begin(), blocks.end(), [](const Block& a, const Block& b) {
+                  return SampleLogBlock::get_sequence(a.data()) < SampleLogBlock::get_sequence(b.data());
+              });
+
+    std::printf("boot,time_s");
+
+    for (size_t field = 0; field < TimeSeriesStore::FIELD_COUNT; field++)
+    {
+        std::printf(",%s", get_series_field_name(static_cast<SeriesField>(field)));
+    }
+
+    std::printf("\n");
+
+    for (const auto& block : blocks)
+    {
+        SampleLogBlockReader reader{ block.data() };
+        SampleRecord record{};
+
+        while (reader.next(record))
+        {
+            std::printf("%u,%u", SampleLogBlock::get_boot(block.data()), record.time_s);
+
+            for (float value : record.values)
+            {
+                if (std::isnan(value))
+                {
+                    std::printf(",");
+                }
+                else
+                {
+                    std::printf(",%.3f", value);
+                }
+            }
+
+            std::printf("\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,418 @@
+/****************************************************************************************
+ * SnapshotBench.cpp - Measures the ConflatingMailbox publish against a queue per subscriber
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Publishes AxpValues to 3 to 32 subscribers and reports the time of one publish and
+//  every subscriber taking the value, and the memory the subscribers cost:
+//
+//      queue       a mutex guarded queue of 2 AxpValues per subscriber, what a
+//                  SubscribingTaskEventQueue created with a size of 2 holds, the value
+//                  is copied into every queue, the task is woken and copies it out
+//      mailbox     ConflatingMailbox<AxpValue>::publish(), the registry and mailbox
+//                  locks, the signal of every mailbox and the task delivering the value
+//                  under the mailbox lock, as the panes get the SensorFrame
+//      snapshot    the SnapshotChannel alone, one write and one read per subscriber
+//
+//  Smooth's queues need running tasks, so the mailboxes get a stand-in signal queue of
+//  1 and both the queues and the signal queues wake the task through the same stand-in
+//  of its notification, a mutex guarded list of the queues with an event that the task
+//  drains after the publish.  The memory of the signal queues is left out.  Before the
+//  timing one writer and 3 reader threads run on the channel for a while and every
+//  value read is checked to be one the writer wrote, not a mix of two.
+//
+//      SnapshotBench [--rounds <n>]
+/////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <smooth/core/Task.h>
+#include <smooth/core/ipc/IEventListener.h>
+#include "model/AxpValue.h"
+#include "model/ConflatingMailbox.h"
+#include "model/SnapshotChannel.h"
+
+using namespace redstone;
+using namespace std::chrono;
+
+namespace
+{
+    volatile uint32_t sink = 0;
+
+    // A queue with an event for the task
+    class IWokenQueue
+    {
+        public:
+            virtual ~IWokenQueue() = default;
+
+            virtual void take_event() = 0;
+    };
+
+    // The stand-in of the notification of a task, the queues with an event in order
+    class TaskNotification
+    {
+        public:
+            void notify(IWokenQueue* queue)
+            {
+                std::lock_guard<std::mutex> lock(guard);
+                woken.push_back(queue);
+            }
+
+            // What the task does when it wakes, every queue gives its event
+            void run_task()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(guard);
+                    taken.swap(woken);
+                }
+
+                for (auto* queue : taken)
+                {
+                    queue->take_event();
+                }
+
+                taken.clear();
+            }
+
+        private:
+            std::mutex guard{};
+            std::vector<IWokenQueue*> woken{};
+            std::vector<IWokenQueue*> taken{};
+    };
+
+    TaskNotification notification;
+
+    // The task of the subscribers, never started
+    class BenchTask : public smooth::core::Task
+    {
+        public:
+            BenchTask() : smooth::core::Task("BenchTask", 4096, 1, milliseconds(1000))
+            {
+            }
+    };
+
+    // A queue of 2 values behind a mutex, as each subscriber has one
+    class ValueQueue : public IWokenQueue
+    {
+        public:
+            bool push(const AxpValue& item)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(guard);
+
+                    if (count == items.size())
+                    {
+                        return false;
+                    }
+
+                    items[(head + count) % items.size()] = item;
+                    count += 1;
+                }
+
+                notification.notify(this);
+
+                return true;
+            }
+
+            void take_event() override
+            {
+                AxpValue item;
+
+                {
+                    std::lock_guard<std::mutex> lock(guard);
+
+                    if (count == 0)
+                    {
+                        return;
+                    }
+
+                    item = items[head];
+                    head = (head + 1) % items.size();
+                    count -= 1;
+                }
+
+                sink = sink + item.get_sequence();
+            }
+
+        private:
+            std::mutex guard{};
+            std::array<AxpValue, 2> items{};
+            size_t head{ 0 };
+            size_t count{ 0 };
+    };
+
+    // The stand-in of the TaskEventQueue of 1 that wakes the task of a mailbox
+    class SignalQueue : public IWokenQueue
+    {
+        public:
+            SignalQueue(smooth::core::ipc::IEventListener<MailboxSignal>& listener) : listener(listener)
+            {
+            }
+
+            static std::shared_ptr<SignalQueue> create(int /*size*/, smooth::core::Task& /*task*/,
+                                                       smooth::core::ipc::IEventListener<MailboxSignal>& listener)
+            {
+                return std::make_shared<SignalQueue>(listener);
+            }
+
+            bool push(const MailboxSignal& /*signal*/)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(guard);
+
+                    if (full)
+                    {
+                        return false;
+                    }
+
+                    full = true;
+                }
+
+                notification.notify(this);
+
+                return true;
+            }
+
+            void take_event() override
+            {
+                {
+                    std::lock_guard<std::mutex> lock(guard);
+
+                    if (!full)
+                    {
+                        return;
+                    }
+
+                    full = false;
+                }
+
+                listener.event(MailboxSignal{});
+            }
+
+        private:
+            smooth::core::ipc::IEventListener<MailboxSignal>& listener;
+            std::mutex guard{};
+            bool full{ false };
+    };
+
+    using BenchMailbox = ConflatingMailbox<AxpValue, SignalQueue>;
+
+    // A subscriber of the mailbox, as a content pane takes the value
+    class Subscriber : public smooth::core::ipc::IEventListener<AxpValue>
+    {
+        public:
+            void event(const AxpValue& value) override
+            {
+                sink = sink + value.get_sequence();
+            }
+    };
+
+    // A value whose fields all tell which publish it is
+    AxpValue make_value(uint32_t number)
+    {
+        AxpValue value;
+        auto f = static_cast<float>(number);
+        value.set_acin_voltage(f);
+        value.set_vbus_voltage(f);
+        value.set_battery_voltage(f);
+        value.set_battery_power(f);
+        value.set_battery_capacity(f);
+        value.set_timestamp_us(number);
+        value.set_sequence(number);
+
+        return value;
+    }
+
+    // Check the fields of a value come from the same publish
+    bool is_consistent(const AxpValue& value)
+    {
+        auto f = static_cast<float>(value.get_sequence());
+
+        return value.get_acin_voltage() == f && value.get_vbus_voltage() == f && value.get_battery_voltage() == f
+               && value.get_battery_power() == f && value.get_battery_capacity() == f
+               && value.get_timestamp_us() == value.get_sequence();
+    }
+
+    // Run one writer and 3 readers on the channel, return the number of torn reads
+    uint64_t check_concurrent_reads(uint64_t& reads, uint32_t& writes)
+    {
+        auto& channel = SnapshotChannel<AxpValue>::instance();
+        std::atomic<bool> done{ false };
+        std::atomic<uint64_t> torn{ 0 };
+        std::atomic<uint64_t> read_count{ 0 };
+        std::vector<std::thread> readers;
+
+        for (int reader = 0; reader < 3; reader++)
+        {
+            readers.emplace_back([&]() {
+                uint64_t local_reads = 0;
+                uint64_t local_torn = 0;
+                AxpValue value;
+
+                while (!done.load())
+                {
+                    if (channel.read(value) > 0)
+                    {
+                        local_reads += 1;
+                        local_torn += is_consistent(value) ? 0 : 1;
+                    }
+                }
+
+                read_count += local_reads;
+                torn += local_torn;
+            });
+        }
+
+        auto end = steady_clock::now() + milliseconds(300);
+        uint32_t number = 0;
+
+        while (steady_clock::now() < end)
+        {
+            channel.write(make_value(++number));
+        }
+
+        done = true;
+
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+
+        reads = read_count;
+        writes = number;
+
+        return torn;
+    }
+
+    // Time a publish and every subscriber taking the value, in ns per publish
+    template<typename Publish>
+    double time_ns_per_publish(int rounds, Publish publish)
+    {
+        auto start = steady_clock::now();
+
+        for (int round = 0; round < rounds; round++)
+        {
+            publish(static_cast<uint32_t>(round));
+        }
+
+        return static_cast<double>(duration_cast<nanoseconds>(steady_clock::now() - start).count()) / rounds;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int rounds = 200000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--rounds") == 0 && i + 1 < argc)
+        {
+            rounds = std::max(1, std::atoi(argv[++i]));
+        }
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--rounds <n>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    uint64_t reads = 0;
+    uint32_t writes = 0;
+    uint64_t torn = check_concurrent_reads(reads, writes);
+
+    std::printf("SnapshotChannel: %u writes, %llu reads on 3 threads, %llu torn\n", writes,
+                static_cast<unsigned long long>(reads), static_cast<unsigned long long>(torn));
+
+    if (torn > 0)
+    {
+        return 1;
+    }
+
+    auto& channel = SnapshotChannel<AxpValue>::instance();
+    BenchTask task;
+
+    std::printf("Publishing a %zu byte AxpValue, %d rounds\n", sizeof(AxpValue), rounds);
+    std::printf("  subscribers   queue ns   mailbox ns   snapshot ns   queue B   mailbox B\n");
+
+    for (int subscribers : { 3, 4, 8, 16, 32 })
+    {
+        std::vector<std::unique_ptr<ValueQueue>> queues;
+
+        for (int subscriber = 0; subscriber < subscribers; subscriber++)
+        {
+            queues.push_back(std::make_unique<ValueQueue>());
+        }
+
+        double queue_ns = time_ns_per_publish(rounds, [&](uint32_t number) {
+            AxpValue value = make_value(number);
+
+            for (auto& queue : queues)
+            {
+                queue->push(value);
+            }
+
+            notification.run_task();
+        });
+
+        std::vector<Subscriber> listeners(subscribers);
+        std::vector<std::shared_ptr<BenchMailbox>> mailboxes;
+
+        for (auto& listener : listeners)
+        {
+            mailboxes.push_back(BenchMailbox::create("Subscriber", task, listener));
+        }
+
+        double mailbox_ns = time_ns_per_publish(rounds, [&](uint32_t number) {
+            BenchMailbox::publish(make_value(number));
+            notification.run_task();
+        });
+
+        auto statistics = mailboxes.front()->get_statistics();
+
+        if (statistics.delivered != static_cast<uint32_t>(rounds))
+        {
+            std::fprintf(stderr, "%u of %d values delivered\n", statistics.delivered, rounds);
+            return 1;
+        }
+
+        mailboxes.clear();
+
+        double snapshot_ns = time_ns_per_publish(rounds, [&](uint32_t number) {
+            channel.write(make_value(number));
+
+            for (int subscriber = 0; subscriber < subscribers; subscriber++)
+            {
+                AxpValue taken;
+                channel.read(taken);
+                sink = sink + taken.get_sequence();
+            }
+        });
+
+        std::printf("  %11d   %8.1f   %10.1f   %11.1f   %7zu   %9zu\n", subscribers, queue_ns, mailbox_ns, snapshot_ns,
+                    subscribers * sizeof(ValueQueue),
+                    subscribers * sizeof(BenchMailbox) + sizeof(SnapshotChannel<AxpValue>));
+    }
+
+    return 0;
+}
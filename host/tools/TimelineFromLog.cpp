@@ -0,0 +1,79 @@
+/****************************************************************************************
+ * TimelineFromLog.cpp - Turns the TIMELINE lines of a console log into a Chrome trace
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Collects the trace events of the Timeline dumps in a saved console log, see
+//  main/model/Timeline.h, and writes them as the file the host build writes with
+//  --timeline, for chrome://tracing or ui.perfetto.dev:
+//
+//      TimelineFromLog console.log > trace.json
+//
+//  The names of the tasks are repeated in every dump and kept once.
+/////////////////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+#include "model/Timeline.h"
+
+using namespace redstone;
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        std::fprintf(stderr, "usage: %s <console log>\n", argv[0]);
+        return 1;
+    }
+
+    static const std::string marker = "TIMELINE ";
+    std::ifstream file(argv[1]);
+    std::string line;
+    std::vector<std::string> events;
+    std::set<std::string> task_names;
+
+    while (std::getline(file, line))
+    {
+        auto start = line.find(marker);
+        auto end = line.rfind('}');
+
+        if (start == std::string::npos || end == std::string::npos || end < start)
+        {
+            continue;
+        }
+
+        // the colour codes of the console follow the event
+        std::string event = line.substr(start + marker.size(), end + 1 - start - marker.size());
+
+        if (event.find("\"ph\":\"M\"") == std::string::npos || task_names.insert(event).second)
+        {
+            events.push_back(event);
+        }
+    }
+
+    if (events.empty())
+    {
+        std::fprintf(stderr, "no TIMELINE lines in %s\n", argv[1]);
+        return 1;
+    }
+
+    Timeline::write_document(events, std::cout);
+
+    return 0;
+}
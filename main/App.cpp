@@ -40,7 +40,14 @@
 // Bin file size: 1,368,000 bytes
 //******************************************************************************************************************
 #include "App.h"
+#include "gui/FlushStatistics.h"
+#include "model/ConflatingMailbox.h"
+#include "model/SensorFrame.h"
+#include "model/Timeline.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
 #include <smooth/core/task_priorities.h>
+#include <smooth/core/ipc/Publisher.h>
 #include <smooth/core/logging/log.h>
 #include <smooth/core/SystemStatistics.h>
 
@@ -62,8 +69,27 @@ namespace redstone
     {
         Log::warning(TAG, "============ Starting APP  ===========");
         Application::init();
+
+        if (RECORD_TIMELINE)
+        {
+            Timeline::instance().start();
+        }
+
+        // The AXP192 powers the display so it is initialized first, the Envir HAT
+        // is brought up by the sensor task while the display and buttons start
         m5stickC.initialize();
-        env_hat.initialize();
+        sensor_task.start();
+
+        if (RECORD_SENSOR_TRACE)
+        {
+            sensor_task.request_trace(SensorRequest::Type::StartTrace);
+        }
+
+        if (RUN_BENCHMARKS)
+        {
+            sensor_task.request_benchmark();
+        }
+
         hw_btn_task.start();
         lvgl_task.start();
         
@@ -79,8 +105,6 @@ namespace redstone
 
         tick_count += 1;
 
-        perform_01_second_tasks();
-        
         if (tick_count == 60)
         {
             tick_count = 0;
@@ -88,12 +112,6 @@ namespace redstone
         }
     }
 
-    void App::perform_01_second_tasks()
-    {
-        env_hat.read_measurements();
-        m5stickC.read_axp_measurements();
-    }
-
     void App::perform_60_second_tasks()
     {
         Log::warning(TAG, "============ M5StickColorEnvir Tick  =============");
@@ -105,9 +123,32 @@ namespace redstone
             alarm_active_count += 1;
             Log::error(TAG, "The Alarm Active Count = {}", alarm_active_count);
             m5stickC.clear_alarm_active();
+
+            AppEvent alarm(AppEvent::Kind::Alarm, "RTC", esp_timer_get_time());
+            ipc::Publisher<AppEvent>::publish(alarm);
+        }
+
+        sensor_task.request_diagnostics();
+
+        if (RECORD_SENSOR_TRACE)
+        {
+            sensor_task.request_trace(SensorRequest::Type::DumpTrace);
+        }
+
+        if (EXPORT_PRESSURE_HISTORY)
+        {
+            sensor_task.request_history_export(SeriesField::Pressure, 24 * 60 * 60, 160, Downsampling::Lttb);
         }
 
         SystemStatistics::instance().dump();
+        FlushStatistics::instance().dump();
+        ConflatingMailbox<SensorFrame>::dump();
+
+        if (RECORD_TIMELINE)
+        {
+            Timeline::instance().dump();
+        }
+
         //m5stickC.print_axp192_report();
     }
 }
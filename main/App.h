@@ -18,8 +18,10 @@
 
 #include <smooth/core/Application.h>
 #include "gui/LvglTask.h"
+#include "model/AppEvent.h"
 #include "model/EnvHat.h"
 #include "model/M5StickC.h"
+#include "model/SensorTask.h"
 #include "button/HwBtnTask.h"
 
 namespace redstone
@@ -34,14 +36,26 @@ namespace redstone
             void tick() override;
 
         private:
-            // perform one second tasks
-            void perform_01_second_tasks();
-
             void perform_60_second_tasks();
 
+            // Record the published sensor values and dump them to the console every minute,
+            // for replaying on the host
+            static constexpr bool RECORD_SENSOR_TRACE = false;
+
+            // Log the pressure of the last 24 hours as 160 points every minute
+            static constexpr bool EXPORT_PRESSURE_HISTORY = false;
+
+            // Record the timeline of the tasks from the sensor reads to the display and dump it
+            // to the console every minute, see model/Timeline.h
+            static constexpr bool RECORD_TIMELINE = false;
+
+            // Run the benchmarks once after boot
+            static constexpr bool RUN_BENCHMARKS = false;
+
             LvglTask lvgl_task{};
             EnvHat env_hat{};
             M5StickC m5stickC{};
+            SensorTask sensor_task{ env_hat, m5stickC };
             HwBtnTask hw_btn_task{};
             uint8_t tick_count{ 0 };
             uint8_t alarm_active_count{ 0 };
@@ -13,12 +13,21 @@ set(SOURCES
         gui/DisplayDriver.cpp
         gui/DisplayDriver.h
 
+        gui/FlushStatistics.cpp
+        gui/FlushStatistics.h
+        gui/Rgb444Packer.cpp
+        gui/Rgb444Packer.h
+
         gui/TitlePane.cpp
         gui/TitlePane.h
 
         gui/IPane.h
         gui/CPBmp280.cpp
         gui/CPBmp280.h
+        gui/CPEventLog.cpp
+        gui/CPEventLog.h
+        gui/CPTrend.cpp
+        gui/CPTrend.h
         gui/CPTemperature.cpp
         gui/CPTemperature.h
         gui/CPHumidity.cpp
@@ -32,11 +41,53 @@ set(SOURCES
        
         model/M5StickC.cpp
         model/M5StickC.h
+        model/AppEvent.h
+        model/ConflatingMailbox.h
         model/AxpValue.h
+        model/Axp192.cpp
+        model/Axp192.h
         model/Axp192Init.h
         model/EnvHat.cpp
         model/EnvHat.h
         model/EnvirValue.h
+        model/EnvirBenchmark.cpp
+        model/EnvirBenchmark.h
+        model/Psychrometrics.cpp
+        model/Psychrometrics.h
+        model/Bmp280Profile.h
+        model/LatencyProbe.cpp
+        model/LatencyProbe.h
+        model/ISampleStore.h
+        model/FatSampleStore.cpp
+        model/FatSampleStore.h
+        model/RawPartitionSampleStore.cpp
+        model/RawPartitionSampleStore.h
+        model/Histogram.h
+        model/HistoryQuery.cpp
+        model/HistoryQuery.h
+        model/I2cBusQueue.cpp
+        model/I2cBusQueue.h
+        model/SampleLog.cpp
+        model/SampleLog.h
+        model/SampleLogger.cpp
+        model/SampleLogger.h
+        model/SampleStoreBenchmark.cpp
+        model/SampleStoreBenchmark.h
+        model/SamplePipeline.cpp
+        model/SamplePipeline.h
+        model/SensorFrame.h
+        model/SensorRequest.h
+        model/SensorScheduler.cpp
+        model/SensorScheduler.h
+        model/SensorTask.cpp
+        model/SensorTask.h
+        model/SensorTrace.cpp
+        model/SensorTrace.h
+        model/SnapshotChannel.h
+        model/TimeSeriesStore.cpp
+        model/Timeline.cpp
+        model/Timeline.h
+        model/TimeSeriesStore.h
 
         button/HwBtnTask.cpp
         button/HwBtnTask.h
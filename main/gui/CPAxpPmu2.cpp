@@ -17,6 +17,8 @@
 #include <sstream>
 #include <iomanip>  // for set precision
 #include "gui/CPAxpPmu2.h"
+#include "model/LatencyProbe.h"
+#include "model/Timeline.h"
 
 #include <smooth/core/logging/log.h>
 using namespace smooth::core::logging;
@@ -25,16 +27,17 @@ namespace redstone
 {
     // Class constants
     static const char* TAG = "CPAxpPmu2";
+    static constexpr uint32_t FIELDS = SensorFrame::AXP192_FIELDS;
 
     // Constructor
     CPAxpPmu2::CPAxpPmu2(smooth::core::Task& task_lvgl) :
-            subr_queue_axp_value(SubQAxpValue::create(2, task_lvgl, *this))
+            subr_mailbox_sensor_frame(MailboxSensorFrame::create(TAG, task_lvgl, *this))
 
-            // Create Subscriber Queue (SubQ) so this content pane can listen for
-            // EnvirValue events
-            // the queue will hold up to 2 items
-            // the "task_lvgl" is this task which to signal when an event is available.
-            // the "*this" is the class instance that will receive the events
+            // Create a Subscriber Mailbox so this content pane can listen for
+            // SensorFrame events
+            // the mailbox holds only the latest value, a newer one replaces it
+            // the "task_lvgl" is this task which to signal when a value is available.
+            // the "*this" is the class instance that will receive the latest value
     {
     }
 
@@ -108,18 +111,27 @@ namespace redstone
         lv_obj_align(battery_power_value_label, label_batt_pwr, LV_ALIGN_OUT_RIGHT_MID, 0, 0);
     }
 
-    // The published AxpValue event
-    void CPAxpPmu2::event(const AxpValue& event)
+    // The published SensorFrame event, a frame without valid AXP192 values is skipped
+    void CPAxpPmu2::event(const SensorFrame& event)
     {
-        aps_voltage = event.get_aps_voltage();
-        axp_device_temperature = event.get_axp_device_temperature();
-        battery_power = event.get_battery_power();
+        LatencyProbe::instance().value_received(TAG, event.get_sequence(), event.get_timestamp_us());
+
+        if (!event.are_valid(FIELDS))
+        {
+            return;
+        }
+
+        const AxpValue& value = event.get_axp_value();
+        aps_voltage = value.get_aps_voltage();
+        axp_device_temperature = value.get_axp_device_temperature();
+        battery_power = value.get_battery_power();
         update_value_texts();
     }
 
     // Update the axp value labels
     void CPAxpPmu2::update_value_texts()
     {
+        TimelineScope scope(TimelineKind::Label, TAG);
         std::ostringstream stream;
 
         stream << std::fixed << std::setprecision(2) << aps_voltage;
@@ -150,4 +162,10 @@ namespace redstone
     {
         lv_obj_set_hidden(content_container, true);
     }
+
+    // Get the mailbox of the pane, paused by the ViewController while the pane is hidden
+    IMailbox* CPAxpPmu2::get_mailbox()
+    {
+        return subr_mailbox_sensor_frame.get();
+    }
 }
@@ -17,6 +17,8 @@
 #include <sstream>
 #include <iomanip>  // for set precision
 #include "gui/CPAxpPmu3.h"
+#include "model/LatencyProbe.h"
+#include "model/Timeline.h"
 
 #include <smooth/core/logging/log.h>
 using namespace smooth::core::logging;
@@ -25,16 +27,17 @@ namespace redstone
 {
     // Class constants
     static const char* TAG = "CPAxpPmu3";
+    static constexpr uint32_t FIELDS = SensorFrame::AXP192_FIELDS;
 
     // Constructor
     CPAxpPmu3::CPAxpPmu3(smooth::core::Task& task_lvgl) :
-            subr_queue_axp_value(SubQAxpValue::create(2, task_lvgl, *this))
+            subr_mailbox_sensor_frame(MailboxSensorFrame::create(TAG, task_lvgl, *this))
 
-            // Create Subscriber Queue (SubQ) so this content pane can listen for
-            // EnvirValue events
-            // the queue will hold up to 2 items
-            // the "task_lvgl" is this task which to signal when an event is available.
-            // the "*this" is the class instance that will receive the events
+            // Create a Subscriber Mailbox so this content pane can listen for
+            // SensorFrame events
+            // the mailbox holds only the latest value, a newer one replaces it
+            // the "task_lvgl" is this task which to signal when a value is available.
+            // the "*this" is the class instance that will receive the latest value
     {
     }
 
@@ -108,18 +111,27 @@ namespace redstone
         lv_obj_align(battery_discharging_value_label, label_batt_dischg, LV_ALIGN_OUT_RIGHT_MID, 0, 0);
     }
 
-    // The published AxpValue event
-    void CPAxpPmu3::event(const AxpValue& event)
+    // The published SensorFrame event, a frame without valid AXP192 values is skipped
+    void CPAxpPmu3::event(const SensorFrame& event)
     {
-        battery_capacity = event.get_battery_capacity();
-        battery_charging_current = event.get_battery_charging_current();
-        battery_discharging_current = event.get_battery_discharging_current();
+        LatencyProbe::instance().value_received(TAG, event.get_sequence(), event.get_timestamp_us());
+
+        if (!event.are_valid(FIELDS))
+        {
+            return;
+        }
+
+        const AxpValue& value = event.get_axp_value();
+        battery_capacity = value.get_battery_capacity();
+        battery_charging_current = value.get_battery_charging_current();
+        battery_discharging_current = value.get_battery_discharging_current();
         update_value_texts();
     }
 
     // Update the axp value labels
     void CPAxpPmu3::update_value_texts()
     {
+        TimelineScope scope(TimelineKind::Label, TAG);
         std::ostringstream stream;
 
         stream << std::fixed << std::setprecision(1) << battery_capacity;
@@ -150,4 +162,10 @@ namespace redstone
     {
         lv_obj_set_hidden(content_container, true);
     }
+
+    // Get the mailbox of the pane, paused by the ViewController while the pane is hidden
+    IMailbox* CPAxpPmu3::get_mailbox()
+    {
+        return subr_mailbox_sensor_frame.get();
+    }
 }
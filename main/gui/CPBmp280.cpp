@@ -17,6 +17,8 @@
 #include <sstream>
 #include <iomanip>  // for set precision
 #include "gui/CPBmp280.h"
+#include "model/LatencyProbe.h"
+#include "model/Timeline.h"
 
 #include <smooth/core/logging/log.h>
 using namespace smooth::core::logging;
@@ -25,16 +27,17 @@ namespace redstone
 {
     // Class constants
     static const char* TAG = "CPBmp280";
+    static constexpr uint32_t FIELDS = SensorFrame::BMP280_FIELDS;
 
     // Constructor
     CPBmp280::CPBmp280(smooth::core::Task& task_lvgl) :
-            subr_queue_envir_value(SubQEnvirValue::create(2, task_lvgl, *this))
+            subr_mailbox_sensor_frame(MailboxSensorFrame::create(TAG, task_lvgl, *this))
 
-            // Create Subscriber Queue (SubQ) so this content pane can listen for
-            // EnvirValue events
-            // the queue will hold up to 2 items
-            // the "task_lvgl" is this task which to signal when an event is available.
-            // the "*this" is the class instance that will receive the events
+            // Create a Subscriber Mailbox so this content pane can listen for
+            // SensorFrame events
+            // the mailbox holds only the latest value, a newer one replaces it
+            // the "task_lvgl" is this task which to signal when a value is available.
+            // the "*this" is the class instance that will receive the latest value
     {
     }
 
@@ -108,18 +111,27 @@ namespace redstone
         lv_obj_align(inhg_press_value_label, label_press_inhg, LV_ALIGN_OUT_RIGHT_MID, 0, 0);
     }
 
-    // The published EnvirValue event
-    void CPBmp280::event(const EnvirValue& event)
+    // The published SensorFrame event, a frame without valid BMP280 values is skipped
+    void CPBmp280::event(const SensorFrame& event)
     {
-        temperature = event.get_bmp280_temperture_degree_F();
-        hpa_pressure = event.get_pressure_hPa();
-        inHg_pressure = event.get_sea_level_pressure_inHg();
+        LatencyProbe::instance().value_received(TAG, event.get_sequence(), event.get_timestamp_us());
+
+        if (!event.are_valid(FIELDS))
+        {
+            return;
+        }
+
+        const EnvirValue& value = event.get_envir_value();
+        temperature = value.get_bmp280_temperture_degree_F();
+        hpa_pressure = value.get_pressure_hPa();
+        inHg_pressure = value.get_sea_level_pressure_inHg();
         update_text();
     }
 
     // Update the temperature and pressure value labela
     void CPBmp280::update_text()
     {
+        TimelineScope scope(TimelineKind::Label, TAG);
         std::ostringstream stream;
 
         stream << std::fixed << std::setprecision(1) << temperature;
@@ -150,4 +162,10 @@ namespace redstone
     {
         lv_obj_set_hidden(content_container, true);
     }
+
+    // Get the mailbox of the pane, paused by the ViewController while the pane is hidden
+    IMailbox* CPBmp280::get_mailbox()
+    {
+        return subr_mailbox_sensor_frame.get();
+    }
 }
@@ -0,0 +1,208 @@
+/****************************************************************************************
+ * CPEventLog.cpp - A content pane that displays the latest application events
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <algorithm>
+#include <cstdio>
+#include "gui/CPEventLog.h"
+
+#include <smooth/core/logging/log.h>
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "CPEventLog";
+
+    // Constructor
+    CPEventLog::CPEventLog(smooth::core::Task& task_lvgl, DisplayDriver& display_driver) :
+            subr_queue_app_event(SubQAppEvent::create(4, task_lvgl, *this)),
+
+            // Create Subscriber Queue (SubQ) so this content pane can listen for
+            // AppEvent events
+            // the queue will hold up to 4 items
+            // the "task_lvgl" is this task which to signal when an event is available.
+            // the "*this" is the class instance that will receive the events
+
+            display_driver(display_driver)
+    {
+    }
+
+    // Create the content pane
+    void CPEventLog::create(int width, int height)
+    {
+        Log::info(TAG, "Creating CPEventLog");
+
+        // create a plain style
+        lv_style_init(&plain_style);
+        lv_style_set_pad_all(&plain_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_line_opa(&plain_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_pad_inner(&plain_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_margin_all(&plain_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_border_width(&plain_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_radius(&plain_style, LV_STATE_DEFAULT, 0);
+
+        // create style for the content container
+        lv_style_copy(&content_container_style, &plain_style);
+        lv_style_set_bg_color(&content_container_style, LV_STATE_DEFAULT, lv_color_hex3(0x000));  // black
+
+        // create a content container, it covers the screen as there is no title pane
+        content_container = lv_cont_create(lv_scr_act(), NULL);
+        lv_obj_add_style(content_container, LV_CONT_PART_MAIN, &content_container_style);
+        lv_obj_set_size(content_container, width, height);
+        lv_obj_align(content_container, NULL, LV_ALIGN_CENTER, 0, 0);
+        lv_obj_set_hidden(content_container, true);
+
+        // create the log, an object that only draws the cards on the container background
+        log = lv_obj_create(content_container, NULL);
+        lv_obj_set_size(log, width, height);
+        lv_obj_set_pos(log, 0, 0);
+        lv_obj_set_click(log, false);
+        lv_obj_set_user_data(log, this);
+        lv_obj_set_design_cb(log, log_design_cb);
+    }
+
+    // The published AppEvent event, the log scrolls by one card
+    void CPEventLog::event(const AppEvent& event)
+    {
+        events[event_count % CARDS] = event;
+        event_count += 1;
+
+        if (shown && display_driver.is_scrolling() && event_count > 1)
+        {
+            lv_area_t area;
+            lv_obj_get_coords(log, &area);
+            display_driver.scroll_left(area, CARD_WIDTH);
+        }
+        else
+        {
+            // the first card replaces the empty log
+            lv_obj_invalidate(log);
+        }
+    }
+
+    // The "C" style design callback, the log never covers the container background
+    lv_design_res_t CPEventLog::log_design_cb(lv_obj_t* obj, const lv_area_t* clip_area, lv_design_mode_t mode)
+    {
+        lv_design_res_t res = LV_DESIGN_RES_OK;
+
+        if (mode == LV_DESIGN_COVER_CHK)
+        {
+            res = LV_DESIGN_RES_NOT_COVER;
+        }
+        else if (mode == LV_DESIGN_DRAW_MAIN)
+        {
+            CPEventLog* pane = reinterpret_cast<CPEventLog*>(lv_obj_get_user_data(obj));
+            pane->draw_log(clip_area);
+        }
+
+        return res;
+    }
+
+    // Draw the cards inside the clip area, the newest on the right
+    void CPEventLog::draw_log(const lv_area_t* clip_area)
+    {
+        lv_area_t coords;
+        lv_obj_get_coords(log, &coords);
+
+        if (event_count == 0)
+        {
+            lv_draw_label_dsc_t text_dsc;
+            lv_draw_label_dsc_init(&text_dsc);
+            text_dsc.color = LV_COLOR_WHITE;
+            text_dsc.font = &lv_font_montserrat_12;
+
+            lv_area_t text_area = coords;
+            text_area.x1 += 4;
+            text_area.y1 += HEADER_HEIGHT + 4;
+            lv_draw_label(&text_area, clip_area, &text_dsc, "No events yet", NULL);
+        }
+
+        uint32_t cards = std::min(event_count, static_cast<uint32_t>(CARDS));
+
+        for (uint32_t age = 0; age < cards; age++)
+        {
+            lv_area_t card;
+            card.x2 = static_cast<lv_coord_t>(coords.x2 - age * CARD_WIDTH);
+            card.x1 = static_cast<lv_coord_t>(card.x2 - CARD_WIDTH + 1);
+            card.y1 = coords.y1;
+            card.y2 = coords.y2;
+
+            uint32_t number = event_count - age;
+            draw_card(card, clip_area, events[(number - 1) % CARDS], number);
+        }
+    }
+
+    // Draw a card, a header with the number and kind of the event then its source and time
+    void CPEventLog::draw_card(const lv_area_t& card, const lv_area_t* clip_area, const AppEvent& event, uint32_t number)
+    {
+        lv_area_t mask;
+
+        if (!_lv_area_intersect(&mask, &card, clip_area))
+        {
+            return;
+        }
+
+        // the left column of the card is left black to separate the cards
+        lv_area_t header = card;
+        header.x1 += 1;
+        header.y2 = static_cast<lv_coord_t>(header.y1 + HEADER_HEIGHT - 1);
+
+        lv_draw_rect_dsc_t header_dsc;
+        lv_draw_rect_dsc_init(&header_dsc);
+        header_dsc.bg_color = event.get_kind() == AppEvent::Kind::Alarm ? LV_COLOR_ORANGE : LV_COLOR_RED;
+        header_dsc.bg_opa = LV_OPA_COVER;
+        lv_draw_rect(&header, &mask, &header_dsc);
+
+        lv_draw_label_dsc_t text_dsc;
+        lv_draw_label_dsc_init(&text_dsc);
+        text_dsc.color = LV_COLOR_WHITE;
+        text_dsc.font = &lv_font_montserrat_12;
+        text_dsc.flag = LV_TXT_FLAG_EXPAND;
+
+        char text[24];
+        lv_area_t line = header;
+        line.x1 += 3;
+        line.y1 += 1;
+        snprintf(text, sizeof(text), "#%u %s", static_cast<unsigned>(number), event.get_kind_name());
+        lv_draw_label(&line, &mask, &text_dsc, text, NULL);
+
+        line.y1 = static_cast<lv_coord_t>(card.y1 + HEADER_HEIGHT + 4);
+        line.y2 = card.y2;
+        lv_draw_label(&line, &mask, &text_dsc, event.get_source(), NULL);
+
+        auto uptime_s = static_cast<uint32_t>(event.get_timestamp_us() / 1000000);
+        snprintf(text, sizeof(text), "up %u:%02u:%02u", static_cast<unsigned>(uptime_s / 3600),
+                 static_cast<unsigned>(uptime_s / 60 % 60), static_cast<unsigned>(uptime_s % 60));
+        line.y1 = static_cast<lv_coord_t>(line.y1 + 18);
+        lv_draw_label(&line, &mask, &text_dsc, text, NULL);
+    }
+
+    // Show the content pane, the log scrolls in hardware while it is shown
+    void CPEventLog::show()
+    {
+        shown = true;
+        lv_obj_set_hidden(content_container, false);
+        display_driver.set_scroll_area(0, LV_HOR_RES_MAX - 1);
+    }
+
+    // Hide the content pane
+    void CPEventLog::hide()
+    {
+        shown = false;
+        display_driver.clear_scroll_area();
+        lv_obj_set_hidden(content_container, true);
+    }
+}
@@ -0,0 +1,101 @@
+/****************************************************************************************
+ * CPEventLog.h - A content pane that displays the latest application events
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The alarms and sensor faults published as AppEvents are drawn as cards, the newest
+//  on the right, and a new event scrolls the log left by one card.  The display scrolls
+//  the columns of the screen, over its full height, so the pane covers the screen and
+//  the view has no title pane.
+//
+//  While the pane is shown the log scrolls in hardware, the DisplayDriver moves it with
+//  one command and only the new card is drawn, and logs the SPI bytes of each step.
+//  Without hardware scrolling the whole log is redrawn.  The cards are drawn from the
+//  events by a design callback, LVGL objects would be redrawn when moved.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <memory>  // for shared pointer
+#include <lvgl/lvgl.h>
+#include <smooth/core/ipc/IEventListener.h>
+#include <smooth/core/ipc/SubscribingTaskEventQueue.h>
+#include "gui/DisplayDriver.h"
+#include "gui/IPane.h"
+#include "model/AppEvent.h"
+
+namespace redstone
+{
+    class CPEventLog : public IPane, public smooth::core::ipc::IEventListener<AppEvent>
+    {
+        public:
+            /// Constructor
+            /// \param task_lvgl The task this class is running under
+            /// \param display_driver The display driver that scrolls the log
+            CPEventLog(smooth::core::Task& task_lvgl, DisplayDriver& display_driver);
+
+            /// Show the content pane
+            void show() override;
+
+            /// Hide the content pane
+            void hide() override;
+
+            /// Create the content pane
+            /// \param width The width of the content pane
+            /// \param height The height of the content pane
+            void create(int width, int height) override;
+
+            /// The AppEvent event that this instance listens for
+            void event(const AppEvent& event) override;
+
+        private:
+            // The width of a card, the log scrolls by one card
+            static constexpr int CARD_WIDTH = 80;
+
+            // The cards shown
+            static constexpr int CARDS = LV_HOR_RES_MAX / CARD_WIDTH;
+
+            // The height of the card header
+            static constexpr int HEADER_HEIGHT = 16;
+
+            /// The "C" style design callback LittlevGL calls to draw the log
+            static lv_design_res_t log_design_cb(lv_obj_t* obj, const lv_area_t* clip_area, lv_design_mode_t mode);
+
+            /// Draw the cards inside the clip area
+            void draw_log(const lv_area_t* clip_area);
+
+            /// Draw a card
+            /// \param card The area of the card
+            /// \param clip_area The area to draw inside
+            /// \param event The event of the card
+            /// \param number The number of the event since boot
+            void draw_card(const lv_area_t& card, const lv_area_t* clip_area, const AppEvent& event, uint32_t number);
+
+            // Subscriber's queue
+            using SubQAppEvent = smooth::core::ipc::SubscribingTaskEventQueue<AppEvent>;
+            std::shared_ptr<SubQAppEvent> subr_queue_app_event;
+
+            DisplayDriver& display_driver;
+            lv_style_t plain_style;
+            lv_style_t content_container_style;
+            lv_obj_t* content_container;
+            lv_obj_t* log;
+
+            std::array<AppEvent, CARDS> events{};
+            uint32_t event_count{ 0 };
+            bool shown{ false };
+    };
+}
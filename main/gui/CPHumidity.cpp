@@ -17,6 +17,8 @@
 #include <sstream>
 #include <iomanip>  // for set precision
 #include "gui/CPHumidity.h"
+#include "model/LatencyProbe.h"
+#include "model/Timeline.h"
 
 #include <smooth/core/logging/log.h>
 using namespace smooth::core::logging;
@@ -25,16 +27,17 @@ namespace redstone
 {
     // Class constants
     static const char* TAG = "CPHumidity";
+    static constexpr uint32_t FIELDS = SensorFrame::DHT12_FIELDS;
 
     // Constructor
     CPHumidity::CPHumidity(smooth::core::Task& task_lvgl) :
-            subr_queue_envir_value(SubQEnvirValue::create(2, task_lvgl, *this))
+            subr_mailbox_sensor_frame(MailboxSensorFrame::create(TAG, task_lvgl, *this))
 
-            // Create Subscriber Queue (SubQ) so this content pane can listen for
-            // EnvirValue events
-            // the queue will hold up to 2 items
-            // the "task_lvgl" is this task which to signal when an event is available.
-            // the "*this" is the class instance that will receive the events
+            // Create a Subscriber Mailbox so this content pane can listen for
+            // SensorFrame events
+            // the mailbox holds only the latest value, a newer one replaces it
+            // the "task_lvgl" is this task which to signal when a value is available.
+            // the "*this" is the class instance that will receive the latest value
     {
     }
 
@@ -108,18 +111,27 @@ namespace redstone
         lv_obj_align(dew_point_value_label, label_dew_point, LV_ALIGN_OUT_RIGHT_MID, 0, 0);
     }
 
-    // The published EnvirValue event
-    void CPHumidity::event(const EnvirValue& event)
+    // The published SensorFrame event, a frame without valid DHT12 values is skipped
+    void CPHumidity::event(const SensorFrame& event)
     {
-        humidity = event.get_relative_humidity();
-        heat_index = event.get_heat_index_fahrenheit();
-        dew_point = event.get_dew_point_fahrenheit();
+        LatencyProbe::instance().value_received(TAG, event.get_sequence(), event.get_timestamp_us());
+
+        if (!event.are_valid(FIELDS))
+        {
+            return;
+        }
+
+        const EnvirValue& value = event.get_envir_value();
+        humidity = value.get_relative_humidity();
+        heat_index = value.get_heat_index_fahrenheit();
+        dew_point = value.get_dew_point_fahrenheit();
         update_value_texts();
     }
 
     // Update the value text labels
     void CPHumidity::update_value_texts()
     {
+        TimelineScope scope(TimelineKind::Label, TAG);
         std::ostringstream stream;
 
         stream << std::fixed << std::setprecision(1) << humidity;
@@ -150,4 +162,10 @@ namespace redstone
     {
         lv_obj_set_hidden(content_container, true);
     }
+
+    // Get the mailbox of the pane, paused by the ViewController while the pane is hidden
+    IMailbox* CPHumidity::get_mailbox()
+    {
+        return subr_mailbox_sensor_frame.get();
+    }
 }
@@ -19,13 +19,13 @@
 #include <memory>  // for shared pointer
 #include <lvgl/lvgl.h>
 #include <smooth/core/ipc/IEventListener.h>
-#include <smooth/core/ipc/SubscribingTaskEventQueue.h>
 #include "gui/IPane.h"
-#include "model/EnvirValue.h"
+#include "model/ConflatingMailbox.h"
+#include "model/SensorFrame.h"
 
 namespace redstone
 {
-    class CPHumidity : public IPane, public smooth::core::ipc::IEventListener<EnvirValue>
+    class CPHumidity : public IPane, public smooth::core::ipc::IEventListener<SensorFrame>
     {
         public:
             /// Constructor
@@ -38,21 +38,24 @@ namespace redstone
             /// Hide the content pane
             void hide() override;
 
+            /// Get the mailbox the pane receives its values from
+            IMailbox* get_mailbox() override;
+
             /// Create the content pane
             /// \param width The width of the content pane
             /// \param height The height of the content pane
             void create(int width, int height) override;
 
-            /// The EnvirValue event that this instance listens for
-            void event(const EnvirValue& event) override;
+            /// The SensorFrame event that this instance listens for
+            void event(const SensorFrame& event) override;
 
         private:
             /// Update the value texts
             void update_value_texts();
 
-            // Subscriber's queue's
-            using SubQEnvirValue = smooth::core::ipc::SubscribingTaskEventQueue<EnvirValue>;
-            std::shared_ptr<SubQEnvirValue> subr_queue_envir_value;
+            // Subscriber's mailbox
+            using MailboxSensorFrame = ConflatingMailbox<SensorFrame>;
+            std::shared_ptr<MailboxSensorFrame> subr_mailbox_sensor_frame;
 
             lv_style_t plain_style;
             lv_style_t content_container_style;
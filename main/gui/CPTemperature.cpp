@@ -17,6 +17,8 @@
 #include <sstream>
 #include <iomanip>  // for set precision
 #include "gui/CPTemperature.h"
+#include "model/LatencyProbe.h"
+#include "model/Timeline.h"
 
 #include <smooth/core/logging/log.h>
 using namespace smooth::core::logging;
@@ -25,16 +27,17 @@ namespace redstone
 {
     // Class constants
     static const char* TAG = "CPTemperature";
+    static constexpr uint32_t FIELDS = SensorFrame::DHT12_FIELDS;
 
     // Constructor
     CPTemperature::CPTemperature(smooth::core::Task& task_lvgl) :
-            subr_queue_envir_value(SubQEnvirValue::create(2, task_lvgl, *this))
+            subr_mailbox_sensor_frame(MailboxSensorFrame::create(TAG, task_lvgl, *this))
 
-            // Create Subscriber Queue (SubQ) so this content pane can listen for
-            // EnvirValue events
-            // the queue will hold up to 2 items
-            // the "task_lvgl" is this task which to signal when an event is available.
-            // the "*this" is the class instance that will receive the events
+            // Create a Subscriber Mailbox so this content pane can listen for
+            // SensorFrame events
+            // the mailbox holds only the latest value, a newer one replaces it
+            // the "task_lvgl" is this task which to signal when a value is available.
+            // the "*this" is the class instance that will receive the latest value
     {
     }
 
@@ -78,16 +81,25 @@ namespace redstone
         lv_obj_align(temperature_value_label, NULL, LV_ALIGN_CENTER, 5, 0);
     }
 
-    // The published EnvirValue event
-    void CPTemperature::event(const EnvirValue& event)
+    // The published SensorFrame event, a frame without valid DHT12 values is skipped
+    void CPTemperature::event(const SensorFrame& event)
     {
-        temperature = event.get_temperture_degree_F();
+        LatencyProbe::instance().value_received(TAG, event.get_sequence(), event.get_timestamp_us());
+
+        if (!event.are_valid(FIELDS))
+        {
+            return;
+        }
+
+        const EnvirValue& value = event.get_envir_value();
+        temperature = value.get_temperture_degree_F();
         update_temperature_text();
     }
 
     // Update the temperature value label
     void CPTemperature::update_temperature_text()
     {
+        TimelineScope scope(TimelineKind::Label, TAG);
         std::ostringstream stream;
 
         stream << std::fixed << std::setprecision(1) << temperature;
@@ -107,4 +119,10 @@ namespace redstone
     {
         lv_obj_set_hidden(content_container, true);
     }
+
+    // Get the mailbox of the pane, paused by the ViewController while the pane is hidden
+    IMailbox* CPTemperature::get_mailbox()
+    {
+        return subr_mailbox_sensor_frame.get();
+    }
 }
@@ -0,0 +1,461 @@
+/****************************************************************************************
+ * CPTrend.cpp - A content pane that displays the recent trend of a sensor value
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>  // for set precision
+#include <limits>
+#include <sstream>
+#include <esp_timer.h>
+#include "gui/CPTrend.h"
+#include "gui/DisplayDriver.h"
+#include "model/HistoryQuery.h"
+#include "model/LatencyProbe.h"
+#include "model/Timeline.h"
+
+#include <smooth/core/logging/log.h>
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "CPTrend";
+
+    // Set the text of a label only if it changed, setting it always invalidates the label
+    static void set_label_text(lv_obj_t* label, const std::string& text)
+    {
+        if (std::strcmp(lv_label_get_text(label), text.c_str()) != 0)
+        {
+            lv_label_set_text(label, text.c_str());
+        }
+    }
+
+    // Format a value with one decimal
+    static std::string format_value(float value)
+    {
+        std::ostringstream stream;
+
+        stream << std::fixed << std::setprecision(1) << value;
+
+        return stream.str();
+    }
+
+    // Constructor
+    CPTrend::CPTrend(smooth::core::Task& task_lvgl, SeriesField field, int minutes) :
+            subr_queue_sensor_frame(SubQSensorFrame::create(2, task_lvgl, *this)),
+
+            // Create Subscriber Queue (SubQ) so this content pane can listen for
+            // SensorFrame events, the chart takes the sample of every frame
+            // the queue will hold up to 2 items
+            // the "task_lvgl" is this task which to signal when an event is available.
+            // the "*this" is the class instance that will receive the events
+
+            field(field),
+            slot_s(std::max(static_cast<uint32_t>(minutes * 60 / COLUMNS), static_cast<uint32_t>(1)))
+    {
+    }
+
+    // Create the content pane
+    void CPTrend::create(int width, int height)
+    {
+        Log::info(TAG, "Creating CPTrend of {}, {}s per column", get_series_field_name(field), slot_s);
+
+        // create a plain style
+        lv_style_init(&plain_style);
+        lv_style_set_pad_all(&plain_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_line_opa(&plain_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_pad_inner(&plain_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_margin_all(&plain_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_border_width(&plain_style, LV_STATE_DEFAULT, 0);
+        lv_style_set_radius(&plain_style, LV_STATE_DEFAULT, 0);
+
+        // create style for the content container
+        lv_style_copy(&content_container_style, &plain_style);
+        lv_style_set_bg_color(&content_container_style, LV_STATE_DEFAULT, lv_color_hex3(0x000));  // black
+
+        // create a content container
+        content_container = lv_cont_create(lv_scr_act(), NULL);
+        lv_obj_add_style(content_container, LV_CONT_PART_MAIN, &content_container_style);
+        lv_obj_set_size(content_container, width, height);
+        lv_obj_align(content_container, NULL, LV_ALIGN_CENTER, 0, 10); // Offset so content pane is below title pane
+        lv_obj_set_hidden(content_container, true);
+
+        // create the chart, an object that only draws the columns on the container background
+        chart = lv_obj_create(content_container, NULL);
+        lv_obj_set_size(chart, width, height);
+        lv_obj_set_pos(chart, 0, 0);
+        lv_obj_set_click(chart, false);
+        lv_obj_set_user_data(chart, this);
+        lv_obj_set_design_cb(chart, chart_design_cb);
+
+        // create style for the labels
+        lv_style_init(&text_label_style);
+        lv_style_set_text_color(&text_label_style, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+        lv_style_set_text_font(&text_label_style, LV_STATE_DEFAULT, &lv_font_montserrat_12);
+
+        // create the labels of the scale and of the latest value
+        scale_max_label = lv_label_create(content_container, NULL);
+        lv_obj_add_style(scale_max_label, LV_LABEL_PART_MAIN, &text_label_style);
+        lv_label_set_text(scale_max_label, "");
+        lv_obj_align(scale_max_label, NULL, LV_ALIGN_IN_TOP_LEFT, 2, 0);
+
+        scale_min_label = lv_label_create(content_container, NULL);
+        lv_obj_add_style(scale_min_label, LV_LABEL_PART_MAIN, &text_label_style);
+        lv_label_set_text(scale_min_label, "");
+        lv_obj_align(scale_min_label, NULL, LV_ALIGN_IN_BOTTOM_LEFT, 2, 0);
+
+        value_label = lv_label_create(content_container, NULL);
+        lv_obj_add_style(value_label, LV_LABEL_PART_MAIN, &text_label_style);
+        lv_label_set_text(value_label, "--");
+        lv_obj_align(value_label, NULL, LV_ALIGN_IN_TOP_RIGHT, -2, 0);
+
+        for (int column = 0; column < COLUMNS; column++)
+        {
+            columns[column] = Column{ std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::quiet_NaN() };
+        }
+
+        fill_from_history();
+    }
+
+    // The published SensorFrame event, the sample of the field is added if it is valid
+    void CPTrend::event(const SensorFrame& event)
+    {
+        // the queue delivers the frame, the mailboxes of the other panes record this themselves
+        TimelineScope scope(TimelineKind::Deliver, TAG);
+        const EnvirValue& envir = event.get_envir_value();
+        const AxpValue& axp = event.get_axp_value();
+        float sample = std::numeric_limits<float>::quiet_NaN();
+        FrameField frame_field = FrameField::Count;
+        int64_t sample_us = envir.get_timestamp_us();
+
+        if (field == SeriesField::Temperature)
+        {
+            sample = envir.get_temperature_degree_C();
+            frame_field = FrameField::Temperature;
+        }
+        else if (field == SeriesField::Humidity)
+        {
+            sample = envir.get_relative_humidity();
+            frame_field = FrameField::Humidity;
+        }
+        else if (field == SeriesField::Pressure)
+        {
+            sample = envir.get_pressure_hPa();
+            frame_field = FrameField::Pressure;
+        }
+        else if (field == SeriesField::Bmp280Temperature)
+        {
+            sample = envir.get_bmp280_temperature_degree_C();
+            frame_field = FrameField::Bmp280Temperature;
+        }
+        else if (field == SeriesField::BatteryVoltage)
+        {
+            sample = axp.get_battery_voltage();
+            frame_field = FrameField::BatteryVoltage;
+            sample_us = axp.get_timestamp_us();
+        }
+        else if (field == SeriesField::BatteryCurrent)
+        {
+            sample = axp.get_battery_charging_current() - axp.get_battery_discharging_current();
+            frame_field = FrameField::BatteryChargingCurrent;
+            sample_us = axp.get_timestamp_us();
+        }
+        else if (field == SeriesField::VbusVoltage)
+        {
+            sample = axp.get_vbus_voltage();
+            frame_field = FrameField::VbusVoltage;
+            sample_us = axp.get_timestamp_us();
+        }
+        else if (field == SeriesField::AxpTemperature)
+        {
+            sample = axp.get_axp_device_temperature();
+            frame_field = FrameField::AxpTemperature;
+            sample_us = axp.get_timestamp_us();
+        }
+
+        LatencyProbe::instance().value_received(TAG, event.get_sequence(), event.get_timestamp_us());
+
+        if (frame_field != FrameField::Count && event.is_valid(frame_field))
+        {
+            // the sample goes into the time slot of the read it comes from
+            measure_flush();
+            add_sample(static_cast<uint32_t>(sample_us / 1000000), sample);
+
+            if (shown)
+            {
+                update_text();
+            }
+        }
+    }
+
+    // Fill the columns with the minimum and maximum of each time slot held by the TimeSeriesStore
+    void CPTrend::fill_from_history()
+    {
+        auto now_s = static_cast<uint32_t>(esp_timer_get_time() / 1000000);
+        uint32_t now_slot = now_s / slot_s;
+        auto shown_slots = static_cast<uint32_t>(COLUMNS - 1);
+        uint32_t first_slot = now_slot >= shown_slots ? now_slot - shown_slots + 1 : 0;
+
+        // The query holds its buffers, too large for the stack of this task
+        auto query = std::make_unique<HistoryQuery>(TimeSeriesStore::instance());
+
+        // Two points for every slot, so the buckets of the query are the slots
+        query->run(field, first_slot * slot_s, (now_slot + 1) * slot_s - 1, (now_slot - first_slot + 1) * 2,
+                   Downsampling::MinMax, [this](const SeriesSample& sample) {
+                       add_sample(sample.time_s, sample.value);
+                   });
+
+        if (has_samples && shown)
+        {
+            update_text();
+        }
+    }
+
+    // Add a sample to the column of its time slot
+    void CPTrend::add_sample(uint32_t time_s, float sample)
+    {
+        uint32_t slot = time_s / slot_s;
+
+        if (!has_samples)
+        {
+            has_samples = true;
+            newest_slot = slot;
+            clear_column((slot + 1) % COLUMNS);
+        }
+        else if (slot > newest_slot)
+        {
+            advance(slot);
+        }
+        else if (newest_slot - slot >= static_cast<uint32_t>(COLUMNS - 1))
+        {
+            // older than the chart
+            return;
+        }
+
+        Column& column = columns[slot % COLUMNS];
+        bool changed = std::isnan(column.min) || sample < column.min || sample > column.max;
+
+        column.min = std::isnan(column.min) ? sample : std::min(column.min, sample);
+        column.max = std::isnan(column.max) ? sample : std::max(column.max, sample);
+        value = sample;
+
+        if (sample < scale_min || sample > scale_max)
+        {
+            fit_scale();
+        }
+        else if (changed)
+        {
+            invalidate_column(static_cast<int>(slot % COLUMNS));
+        }
+    }
+
+    // Move the newest column to a later time slot, the column after it is the blank cursor
+    void CPTrend::advance(uint32_t slot)
+    {
+        auto slots = static_cast<uint32_t>(COLUMNS);
+        uint32_t passed = std::min(slot - newest_slot, slots);
+        bool wrapped = passed == slots || slot % slots < newest_slot % slots;
+
+        for (uint32_t i = 1; i <= passed; i++)
+        {
+            clear_column(static_cast<int>((newest_slot + i) % COLUMNS));
+        }
+
+        newest_slot = slot;
+        clear_column(static_cast<int>((slot + 1) % COLUMNS));
+
+        // Once per sweep the scale is fitted to the columns shown
+        if (wrapped)
+        {
+            fit_scale();
+        }
+    }
+
+    // Clear a column, only a column that was drawn needs to be redrawn
+    void CPTrend::clear_column(int column)
+    {
+        if (!std::isnan(columns[column].min))
+        {
+            columns[column] = Column{ std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::quiet_NaN() };
+            invalidate_column(column);
+        }
+    }
+
+    // Invalidate the pixels of a column, nothing is redrawn while the pane is hidden
+    void CPTrend::invalidate_column(int column)
+    {
+        lv_area_t area;
+        lv_obj_get_coords(chart, &area);
+        area.x1 += column;
+        area.x2 = area.x1;
+        lv_obj_invalidate_area(chart, &area);
+        columns_invalidated += shown ? 1 : 0;
+    }
+
+    // Fit the scale to the columns with a margin and redraw the chart if it changed
+    void CPTrend::fit_scale()
+    {
+        float low = std::numeric_limits<float>::max();
+        float high = std::numeric_limits<float>::lowest();
+
+        for (const Column& column : columns)
+        {
+            if (!std::isnan(column.min))
+            {
+                low = std::min(low, column.min);
+                high = std::max(high, column.max);
+            }
+        }
+
+        if (low <= high)
+        {
+            float middle = (low + high) / 2.0f;
+            float span = std::max(high - low, MIN_SPAN) * 1.2f;
+            float new_min = middle - span / 2.0f;
+            float new_max = middle + span / 2.0f;
+
+            if (new_min != scale_min || new_max != scale_max)
+            {
+                scale_min = new_min;
+                scale_max = new_max;
+                lv_obj_invalidate(chart);
+                full_redraws += shown ? 1 : 0;
+            }
+        }
+    }
+
+    // Update the scale and value labels, a label is only redrawn when its text changed
+    void CPTrend::update_text()
+    {
+        TimelineScope scope(TimelineKind::Label, TAG);
+        set_label_text(scale_max_label, format_value(scale_max));
+        set_label_text(scale_min_label, format_value(scale_min));
+        set_label_text(value_label, format_value(value));
+        lv_obj_align(value_label, NULL, LV_ALIGN_IN_TOP_RIGHT, -2, 0);
+    }
+
+    // Get the y of a value in the chart
+    lv_coord_t CPTrend::get_y(float sample) const
+    {
+        lv_area_t area;
+        lv_obj_get_coords(chart, &area);
+        lv_coord_t height = lv_area_get_height(&area);
+        float fraction = (sample - scale_min) / (scale_max - scale_min);
+        auto offset = static_cast<lv_coord_t>(std::lround(fraction * (height - 1)));
+
+        return area.y2 - std::min(std::max(offset, static_cast<lv_coord_t>(0)), static_cast<lv_coord_t>(height - 1));
+    }
+
+    // The "C" style design callback, the chart never covers the container background
+    lv_design_res_t CPTrend::chart_design_cb(lv_obj_t* obj, const lv_area_t* clip_area, lv_design_mode_t mode)
+    {
+        lv_design_res_t res = LV_DESIGN_RES_OK;
+
+        if (mode == LV_DESIGN_COVER_CHK)
+        {
+            res = LV_DESIGN_RES_NOT_COVER;
+        }
+        else if (mode == LV_DESIGN_DRAW_MAIN)
+        {
+            CPTrend* pane = reinterpret_cast<CPTrend*>(lv_obj_get_user_data(obj));
+            pane->draw_chart(clip_area);
+        }
+
+        return res;
+    }
+
+    // Draw the columns inside the clip area, each a bar from its minimum to its maximum
+    void CPTrend::draw_chart(const lv_area_t* clip_area)
+    {
+        lv_area_t coords;
+        lv_obj_get_coords(chart, &coords);
+
+        lv_draw_rect_dsc_t column_dsc;
+        lv_draw_rect_dsc_init(&column_dsc);
+        column_dsc.bg_color = LV_COLOR_LIME;
+        column_dsc.bg_opa = LV_OPA_COVER;
+
+        int first = std::max(0, clip_area->x1 - coords.x1);
+        int last = std::min(COLUMNS - 1, clip_area->x2 - coords.x1);
+
+        for (int column = first; column <= last; column++)
+        {
+            if (!std::isnan(columns[column].min))
+            {
+                lv_area_t bar;
+                bar.x1 = static_cast<lv_coord_t>(coords.x1 + column);
+                bar.x2 = bar.x1;
+                bar.y1 = get_y(columns[column].max);
+                bar.y2 = get_y(columns[column].min);
+                lv_draw_rect(&bar, clip_area, &column_dsc);
+            }
+        }
+    }
+
+    // Report the bytes flushed between the updates, they are the redraws of the update before
+    void CPTrend::measure_flush()
+    {
+        uint64_t flushed = DisplayDriver::get_flushed_bytes();
+
+        if (shown && updates_to_skip > 0)
+        {
+            // the redraw of the whole pane when it is shown
+            updates_to_skip -= 1;
+        }
+        else if (shown)
+        {
+            uint64_t bytes = flushed - flushed_at_update;
+            update_bytes += bytes;
+            max_update_bytes = std::max(max_update_bytes, bytes);
+            updates += 1;
+
+            if (updates == REPORT_INTERVAL)
+            {
+                Log::info(TAG, "Flush per update: avg={}B max={}B, {} columns invalidated, {} full redraws",
+                          update_bytes / updates, max_update_bytes, columns_invalidated, full_redraws);
+                updates = 0;
+                update_bytes = 0;
+                max_update_bytes = 0;
+                columns_invalidated = 0;
+                full_redraws = 0;
+            }
+        }
+
+        flushed_at_update = flushed;
+    }
+
+    // Show the content pane, the columns are kept while it is hidden but the labels are not
+    void CPTrend::show()
+    {
+        shown = true;
+        updates_to_skip = 2;
+
+        if (has_samples)
+        {
+            update_text();
+        }
+
+        lv_obj_set_hidden(content_container, false);
+    }
+
+    // Hide the content pane
+    void CPTrend::hide()
+    {
+        shown = false;
+        lv_obj_set_hidden(content_container, true);
+    }
+}
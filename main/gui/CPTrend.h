@@ -0,0 +1,155 @@
+/****************************************************************************************
+ * CPTrend.h - A content pane that displays the recent trend of a sensor value
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The last N minutes of a field are drawn as one column per pixel across the pane, each
+//  column a bar from the lowest to the highest value of its time slot.  The pane keeps
+//  its own history, the minimum and maximum of every column, and fills it from the
+//  TimeSeriesStore when it is created.
+//
+//  The chart is a sweep: the column of a time slot is always at the same x, slot % 160,
+//  and the column after the newest one is left blank as the cursor.  A new sample only
+//  changes the newest column, a new slot clears one column and moves the cursor, so an
+//  update invalidates at most two 1 pixel wide columns and the labels, never the chart.
+//  The scale only grows when a value falls outside it and is fitted again once per
+//  sweep, these are the only full redraws.
+//  While the pane is hidden its columns are kept up to date, its labels are only set
+//  again when it is shown.
+//
+//  The bytes flushed to the display between the updates are reported every
+//  REPORT_INTERVAL updates while the pane is shown.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <memory>  // for shared pointer
+#include <lvgl/lvgl.h>
+#include <smooth/core/ipc/IEventListener.h>
+#include <smooth/core/ipc/SubscribingTaskEventQueue.h>
+#include "gui/IPane.h"
+#include "model/SensorFrame.h"
+#include "model/TimeSeriesStore.h"
+
+namespace redstone
+{
+    class CPTrend : public IPane, public smooth::core::ipc::IEventListener<SensorFrame>
+    {
+        public:
+            /// Constructor
+            /// \param task_lvgl The task this class is running under
+            /// \param field The field to display
+            /// \param minutes The time the width of the chart covers
+            CPTrend(smooth::core::Task& task_lvgl, SeriesField field, int minutes);
+
+            /// Show the content pane
+            void show() override;
+
+            /// Hide the content pane
+            void hide() override;
+
+            /// Create the content pane
+            /// \param width The width of the content pane
+            /// \param height The height of the content pane
+            void create(int width, int height) override;
+
+            /// The SensorFrame event that this instance listens for
+            void event(const SensorFrame& event) override;
+
+        private:
+            // The columns of the chart, one per pixel
+            static constexpr int COLUMNS = LV_HOR_RES_MAX;
+
+            // The smallest span of the scale, in the units of the field
+            static constexpr float MIN_SPAN = 1.0f;
+
+            // The updates between the flush reports
+            static constexpr uint32_t REPORT_INTERVAL = 60;
+
+            /// The lowest and highest value of a time slot, NaN if it has no value
+            struct Column
+            {
+                float min;
+                float max;
+            };
+
+            /// The "C" style design callback LittlevGL calls to draw the chart
+            static lv_design_res_t chart_design_cb(lv_obj_t* obj, const lv_area_t* clip_area, lv_design_mode_t mode);
+
+            /// Draw the columns of the chart inside the clip area
+            void draw_chart(const lv_area_t* clip_area);
+
+            /// Fill the columns from the TimeSeriesStore
+            void fill_from_history();
+
+            /// Add a sample to its column
+            /// \param time_s The time of the sample in seconds since boot
+            /// \param value The value
+            void add_sample(uint32_t time_s, float value);
+
+            /// Move the newest column to a later time slot, clearing the columns passed
+            void advance(uint32_t slot);
+
+            /// Clear a column
+            void clear_column(int column);
+
+            /// Invalidate the pixels of a column
+            void invalidate_column(int column);
+
+            /// Fit the scale to the columns, with a margin, and redraw the chart
+            void fit_scale();
+
+            /// Update the scale and value labels
+            void update_text();
+
+            /// Report the bytes flushed for the updates
+            void measure_flush();
+
+            /// Get the y of a value in the chart
+            lv_coord_t get_y(float value) const;
+
+            // Subscriber's queue's
+            using SubQSensorFrame = smooth::core::ipc::SubscribingTaskEventQueue<SensorFrame>;
+            std::shared_ptr<SubQSensorFrame> subr_queue_sensor_frame;
+
+            lv_style_t plain_style;
+            lv_style_t content_container_style;
+            lv_style_t text_label_style;
+            lv_obj_t* content_container;
+            lv_obj_t* chart;
+            lv_obj_t* scale_max_label;
+            lv_obj_t* scale_min_label;
+            lv_obj_t* value_label;
+
+            SeriesField field;
+            uint32_t slot_s;
+            std::array<Column, COLUMNS> columns{};
+            uint32_t newest_slot{ 0 };
+            bool has_samples{ false };
+            float scale_min{ 0.0f };
+            float scale_max{ 0.0f };
+            float value{ 0.0f };
+
+            bool shown{ false };
+            uint32_t updates_to_skip{ 0 };
+            uint64_t flushed_at_update{ 0 };
+            uint32_t updates{ 0 };
+            uint64_t update_bytes{ 0 };
+            uint64_t max_update_bytes{ 0 };
+            uint32_t columns_invalidated{ 0 };
+            uint32_t full_redraws{ 0 };
+    };
+}
@@ -15,8 +15,14 @@
  * Licensed under MIT License
  ***************************************************************************************/
 #include "gui/DisplayDriver.h"
+#include <algorithm>
 #include <esp_freertos_hooks.h>
+#include <esp_timer.h>
 #include <smooth/core/logging/log.h>
+#include "gui/FlushStatistics.h"
+#include "gui/Rgb444Packer.h"
+#include "model/LatencyProbe.h"
+#include "model/Timeline.h"
 
 using namespace smooth::core::io::spi;
 using namespace smooth::application::display;
@@ -27,6 +33,14 @@ namespace redstone
 {
     // Class Constants
     static const char* TAG = "DisplayDriver";
+    static constexpr uint8_t CMD_VSCRDEF = 0x33;
+    static constexpr uint8_t CMD_VSCRSADD = 0x37;
+
+    // The bytes flushed since boot
+    uint64_t DisplayDriver::flushed_bytes = 0;
+
+    // The command bytes sent since boot
+    uint64_t DisplayDriver::command_bytes = 0;
 
     // Constructor
     DisplayDriver::DisplayDriver()
@@ -52,14 +66,23 @@ namespace redstone
             // Verify that video_display_buffer1 has been created.
             if (video_display_buffer1.is_buffer_allocated())
             {
-                // initialize a display buffer
+                // initialize a display buffer, with a second one LittlevGL draws while the DMA sends
                 vdb1 = reinterpret_cast<lv_color1_t*>(video_display_buffer1.data());
-                lv_disp_buf_init(&disp_buf, vdb1, NULL, MAX_DMA_LEN / COLOR_SIZE);
+                double_buffered = DOUBLE_BUFFERED && video_display_buffer2.is_buffer_allocated();
+
+                if (double_buffered)
+                {
+                    vdb2 = reinterpret_cast<lv_color1_t*>(video_display_buffer2.data());
+                }
+
+                lv_disp_buf_init(&disp_buf, vdb1, vdb2, MAX_DMA_LEN / COLOR_SIZE);
+                Log::info(TAG, "Display buffers: {} of {} bytes", double_buffered ? 2 : 1, MAX_DMA_LEN);
 
                 // initialize and register a display driver
                 lv_disp_drv_init(&disp_drv);
                 disp_drv.buffer = &disp_buf;
                 disp_drv.flush_cb = display_flush_cb;
+                disp_drv.monitor_cb = display_monitor_cb;
                 disp_drv.user_data = this;
                 lv_disp_drv_register(&disp_drv);
             }
@@ -117,6 +140,13 @@ namespace redstone
         st7735S_initialized &= device->send_cmd(LcdCmd::INVON);  // display inversion on
         st7735S_initialized &= device->send_init_cmds(init_cmds_R_part3.data(), init_cmds_R_part3.size());
 
+        if (RGB444_TRANSFER)
+        {
+            // 12 bit pixels, packed from the 16 bit pixels LittlevGL draws on each flush
+            uint8_t colmod = COLMOD_12_BIT;
+            st7735S_initialized &= device->send_cmd_with_data(LcdCmd::COLMOD, &colmod, 1);
+        }
+
         lcd_display = std::move(device);
         
         if (!st7735S_initialized)
@@ -154,11 +184,55 @@ namespace redstone
     // A class instance callback to flush the display buffer and thereby write colors to screen
     void DisplayDriver::display_drv_flush(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_map)
     {
-        uint32_t x1 = area->x1;
-        uint32_t y1 = area->y1;
-        uint32_t x2 = area->x2;
-        uint32_t y2 = area->y2;
+        TimelineScope scope(TimelineKind::Flush, "flush");
+        FlushStatistics::instance().flush_started(esp_timer_get_time());
+        uint64_t flushed_before = flushed_bytes;
+        flush_transfers = 0;
+        flush_wait_us = 0;
 
+        Segment segments[4];
+        int count = get_segments(area->x1, area->x2, segments);
+
+        if (count == 1)
+        {
+            send_area(segments[0].memory_x, area->y1, segments[0].memory_x + segments[0].width - 1, area->y2, color_map);
+        }
+        else
+        {
+            // The scroll offset splits the rows of the area, the parts of a row are sent one by one
+            lv_coord_t width = lv_area_get_width(area);
+
+            for (lv_coord_t y = area->y1; y <= area->y2; y++)
+            {
+                lv_color_t* row = color_map + (y - area->y1) * width;
+
+                for (int i = 0; i < count; i++)
+                {
+                    send_area(segments[i].memory_x, y, segments[i].memory_x + segments[i].width - 1, y,
+                              row + (segments[i].x - area->x1));
+                }
+            }
+        }
+
+        FlushStatistics::instance().flush_finished(esp_timer_get_time(), lv_area_get_size(area),
+                                                   static_cast<uint32_t>(flushed_bytes - flushed_before),
+                                                   flush_transfers, flush_wait_us);
+
+        // Log the boot-to-first-frame time
+        if (!first_frame_flushed)
+        {
+            first_frame_flushed = true;
+            Log::info(TAG, "First frame flushed {} ms after boot", esp_timer_get_time() / 1000);
+        }
+
+        // Inform the lvgl graphics library that we are ready for flushing the VDB buffer
+        lv_disp_t* disp = _lv_refr_get_disp_refreshing();
+        lv_disp_flush_ready(&disp->driver);
+    }
+
+    // Send an area of the screen to its frame memory address window
+    void DisplayDriver::send_area(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, lv_color_t* color_map)
+    {
         // The M5StickC (ST7735S) needs offsets applied otherwise display is not shown correctly on screen
         if (LV_VER_RES_MAX > LV_HOR_RES_MAX) // portrait
         {
@@ -185,8 +259,7 @@ namespace redstone
         // Drawing area that has a height of LINES_TO_SEND
         while (number_of_dma_blocks_with_complete_lines_to_send--)
         {
-            lcd_display->send_lines(x1, start_row, x2, end_row, reinterpret_cast<uint8_t*>(color_map), MAX_DMA_LEN);
-            lcd_display->wait_for_send_lines_to_finish();
+            queue_lines(x1, start_row, x2, end_row, color_map, MAX_DMA_LEN);
 
             // color_map is pointer to type lv_color_t were the data type is based on color size so the
             // color_map pointer may have a data type of uint8_t or uint16_t or uint32_t.  MAX_DMA_LEN is
@@ -203,16 +276,217 @@ namespace redstone
         if (number_of_bytes_in_not_complete_lines_to_send)
         {
             end_row = y2;
-            lcd_display->send_lines(x1, start_row, x2, end_row,
-                                reinterpret_cast<uint8_t*>(color_map),
-                                number_of_bytes_in_not_complete_lines_to_send);
+            queue_lines(x1, start_row, x2, end_row, color_map, number_of_bytes_in_not_complete_lines_to_send);
+        }
+    }
+
+    // Queue the pixel data of an address window, only one send_lines() is in flight at a time
+    void DisplayDriver::queue_lines(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, lv_color_t* data, uint32_t length)
+    {
+        if (RGB444_TRANSFER)
+        {
+            // packed in place, the buffer is not drawn into until the flush returns
+            length = static_cast<uint32_t>(pack_rgb444(reinterpret_cast<uint8_t*>(data), length / COLOR_SIZE));
+        }
+
+        flushed_bytes += length;
+        finish_transfer();
 
+        lcd_display->send_lines(x1, y1, x2, y2, reinterpret_cast<uint8_t*>(data), length);
+        command_bytes += ADDRESS_WINDOW_BYTES;
+        flush_transfers += 1;
+        transfer_pending = true;
+
+        // With one buffer LittlevGL draws into the buffer being sent once the flush returns
+        if (!double_buffered)
+        {
+            finish_transfer();
+        }
+    }
+
+    // Wait for the transfer in flight to be done
+    void DisplayDriver::finish_transfer()
+    {
+        if (transfer_pending)
+        {
+            TimelineScope scope(TimelineKind::Flush, "DMA wait");
+            int64_t start_us = esp_timer_get_time();
             lcd_display->wait_for_send_lines_to_finish();
+            transfer_pending = false;
+            flush_wait_us += esp_timer_get_time() - start_us;
         }
+    }
 
-        // Inform the lvgl graphics library that we are ready for flushing the VDB buffer
-        lv_disp_t* disp = _lv_refr_get_disp_refreshing();
-        lv_disp_flush_ready(&disp->driver);
+    // Split the columns of an area into the ranges sent to contiguous frame memory columns
+    int DisplayDriver::get_segments(lv_coord_t x1, lv_coord_t x2, Segment* segments) const
+    {
+        int count = 0;
+        lv_coord_t x = x1;
+
+        while (x <= x2)
+        {
+            lv_coord_t memory_x = x;
+            lv_coord_t end = x2;
+
+            if (scrolling && x < scroll_x1)
+            {
+                end = std::min(x2, static_cast<lv_coord_t>(scroll_x1 - 1));
+            }
+            else if (scrolling && x <= scroll_x2)
+            {
+                lv_coord_t width = scroll_x2 - scroll_x1 + 1;
+                lv_coord_t position = (x - scroll_x1 + scroll_offset) % width;
+                memory_x = scroll_x1 + position;
+                end = std::min({ x2, scroll_x2, static_cast<lv_coord_t>(x + width - position - 1) });
+            }
+
+            lv_coord_t width = end - x + 1;
+
+            if (count > 0 && segments[count - 1].memory_x + segments[count - 1].width == memory_x)
+            {
+                segments[count - 1].width += width;
+            }
+            else
+            {
+                segments[count++] = Segment{ x, memory_x, width };
+            }
+
+            x = end + 1;
+        }
+
+        return count;
+    }
+
+    // Set the columns of the screen that scroll in hardware
+    bool DisplayDriver::set_scroll_area(lv_coord_t x1, lv_coord_t x2)
+    {
+        if (LV_VER_RES_MAX > LV_HOR_RES_MAX || x1 < 0 || x2 >= LV_HOR_RES_MAX || x1 >= x2)
+        {
+            // in portrait the memory rows are the rows of the screen, not supported
+            Log::error(TAG, "Scroll area {}..{} not supported", x1, x2);
+            return false;
+        }
+
+        if (scrolling && scroll_offset != 0)
+        {
+            // the screen was drawn through the old offset
+            lv_obj_invalidate(lv_scr_act());
+        }
+
+        // MY of the landscape MADCTL reverses the memory rows, the last column is the
+        // first row of the band
+        auto height = static_cast<uint16_t>(x2 - x1 + 1);
+        top_fixed_rows = static_cast<uint16_t>(MEMORY_ROWS - 1 - (x2 + offsets_green_tab_160x80.row_offset));
+        auto bottom_fixed_rows = static_cast<uint16_t>(MEMORY_ROWS - top_fixed_rows - height);
+
+        finish_transfer();
+
+        uint8_t data[6] = { static_cast<uint8_t>(top_fixed_rows >> 8), static_cast<uint8_t>(top_fixed_rows),
+                            static_cast<uint8_t>(height >> 8), static_cast<uint8_t>(height),
+                            static_cast<uint8_t>(bottom_fixed_rows >> 8), static_cast<uint8_t>(bottom_fixed_rows) };
+
+        scrolling = lcd_display->send_cmd_with_data(CMD_VSCRDEF, data, sizeof(data));
+        command_bytes += 1 + sizeof(data);
+        scroll_x1 = x1;
+        scroll_x2 = x2;
+        scroll_offset = 0;
+
+        if (scrolling)
+        {
+            send_scroll_start();
+        }
+
+        return scrolling;
+    }
+
+    // Scroll the content of an area left in hardware and invalidate what must not have moved
+    void DisplayDriver::scroll_left(const lv_area_t& area, lv_coord_t columns)
+    {
+        if (!scrolling || columns <= 0)
+        {
+            return;
+        }
+
+        lv_coord_t width = scroll_x2 - scroll_x1 + 1;
+        columns = std::min(columns, width);
+
+        if (!scroll_step_pending)
+        {
+            scroll_step_pending = true;
+            flushed_at_scroll_step = flushed_bytes;
+            commands_at_scroll_step = command_bytes;
+        }
+
+        scroll_offset = static_cast<lv_coord_t>((scroll_offset + columns) % width);
+        send_scroll_start();
+
+        // The rows of the band above and below the area moved with it
+        lv_obj_t* screen = lv_scr_act();
+        lv_area_t moved;
+
+        if (area.y1 > 0)
+        {
+            lv_area_set(&moved, scroll_x1, 0, scroll_x2, area.y1 - 1);
+            lv_obj_invalidate_area(screen, &moved);
+        }
+
+        if (area.y2 < LV_VER_RES_MAX - 1)
+        {
+            lv_area_set(&moved, scroll_x1, area.y2 + 1, scroll_x2, LV_VER_RES_MAX - 1);
+            lv_obj_invalidate_area(screen, &moved);
+        }
+
+        // The columns exposed on the right show what scrolled out on the left
+        lv_area_set(&moved, scroll_x2 - columns + 1, area.y1, scroll_x2, area.y2);
+        lv_obj_invalidate_area(screen, &moved);
+
+        scroll_step_software_bytes = get_transfer_bytes(static_cast<uint32_t>(width * lv_area_get_height(&area))) +
+                                     ADDRESS_WINDOW_BYTES;
+    }
+
+    // Leave the hardware scrolling, NORON ends the scroll mode
+    void DisplayDriver::clear_scroll_area()
+    {
+        if (scrolling)
+        {
+            finish_transfer();
+            lcd_display->send_cmd(LcdCmd::NORON);
+            command_bytes += 1;
+            scrolling = false;
+
+            if (scroll_offset != 0)
+            {
+                // the screen was drawn through the offset
+                scroll_offset = 0;
+                lv_obj_invalidate(lv_scr_act());
+            }
+        }
+    }
+
+    // Send the memory row shown first in the scroll area, MY makes the content move left as it grows
+    void DisplayDriver::send_scroll_start()
+    {
+        lv_coord_t height = scroll_x2 - scroll_x1 + 1;
+        auto start = static_cast<uint16_t>(top_fixed_rows + (height - scroll_offset) % height);
+        uint8_t data[2] = { static_cast<uint8_t>(start >> 8), static_cast<uint8_t>(start) };
+
+        finish_transfer();
+        lcd_display->send_cmd_with_data(CMD_VSCRSADD, data, sizeof(data));
+        command_bytes += 1 + sizeof(data);
+    }
+
+    // Log the bytes sent for a scroll step, called when the refresh after it has been flushed
+    void DisplayDriver::report_scroll_step()
+    {
+        if (scroll_step_pending)
+        {
+            scroll_step_pending = false;
+            uint64_t commands = command_bytes - commands_at_scroll_step;
+            uint64_t bytes = flushed_bytes - flushed_at_scroll_step + commands;
+
+            Log::info(TAG, "Scroll step: {}B over SPI, {}B of them commands, a redraw of the area is {}B",
+                      bytes, commands, scroll_step_software_bytes);
+        }
     }
 
     // The "C" style callback required by LittlevGL
@@ -221,4 +495,37 @@ namespace redstone
         DisplayDriver* driver = reinterpret_cast<DisplayDriver*>(drv->user_data);
         driver->display_drv_flush(drv, area, color_map);
     }
+
+    // The "C" style callback LittlevGL calls when all the areas of a refresh have been flushed,
+    // the last transfer is waited for so the frame is on the display
+    void DisplayDriver::display_monitor_cb(lv_disp_drv_t* drv, uint32_t time, uint32_t px)
+    {
+        DisplayDriver* driver = reinterpret_cast<DisplayDriver*>(drv->user_data);
+        int64_t start_us = esp_timer_get_time();
+        driver->finish_transfer();
+        int64_t now_us = esp_timer_get_time();
+
+        LatencyProbe::instance().frame_flushed(now_us);
+        Timeline::instance().instant(TimelineKind::Display, "frame on display");
+        FlushStatistics::instance().frame_finished(now_us - start_us);
+        driver->report_scroll_step();
+        driver->report_refresh(time, px, now_us - start_us);
+    }
+
+    // Log the time of a refresh of the whole screen, the time of a view switch
+    void DisplayDriver::report_refresh(uint32_t time_ms, uint32_t px, int64_t wait_us)
+    {
+        if (px >= static_cast<uint32_t>(LV_HOR_RES_MAX * LV_VER_RES_MAX))
+        {
+            Log::info(TAG, "Full screen refresh: {} us with {} buffers of {} bit pixels",
+                      static_cast<int64_t>(time_ms) * 1000 + wait_us, double_buffered ? 2 : 1,
+                      RGB444_TRANSFER ? 12 : 16);
+        }
+    }
+
+    // Get the bytes a number of pixels take over SPI
+    uint32_t DisplayDriver::get_transfer_bytes(uint32_t pixels)
+    {
+        return RGB444_TRANSFER ? static_cast<uint32_t>(get_rgb444_size(pixels)) : pixels * COLOR_SIZE;
+    }
 }
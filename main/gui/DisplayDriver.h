@@ -14,6 +14,41 @@
  * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
  * Licensed under MIT License
  ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Flushing
+//
+//  LittlevGL draws into two DMA buffers in turn.  A flush queues the transfer of its
+//  buffer and returns at once, so LittlevGL draws the next area into the other buffer
+//  while the DMA sends this one.  The wait for a transfer is moved to the start of the
+//  next transfer or command and to the end of the refresh, so a buffer is never drawn
+//  into while it is sent and only one send_lines() is ever in flight.  With one buffer
+//  each transfer is waited for before the flush returns.
+//
+//  With RGB444_TRANSFER the panel is set to 12 bit pixels and each buffer is packed in
+//  place before it is sent, 3 bytes for 2 pixels instead of 4, see Rgb444Packer.h.
+//
+//  The time of each refresh of the whole screen, a view switch, is logged and the cost
+//  of every flush is recorded by the FlushStatistics.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Hardware scrolling
+//
+//  The ST7735S scrolls a band of its 162 frame memory rows, VSCRDEF sets the band and
+//  VSCRSADD the memory row shown first, so a scroll step is one 3 byte command.  In
+//  landscape the memory rows are the columns of the screen, the band is a range of
+//  screen columns over the full height and it scrolls left and right.
+//
+//  LVGL keeps drawing in screen coordinates, the flush maps the columns of the band
+//  through the scroll offset to the memory columns that are shown there.  After a step
+//  the content moved with the band, scroll_left() invalidates what must not have moved,
+//  the rows of the band outside the scrolled area, and the columns it exposed, the
+//  rest needs no redraw.  An area the offset splits is sent one row at a time.
+//
+//  The SPI bytes of each step, commands and redraw, are logged against the bytes a
+//  redraw of the whole scrolled area would take.
+/////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
 #include <lvgl/lvgl.h>
@@ -32,16 +67,101 @@ namespace redstone
             /// Initialize the Lvgl Display Driver
             bool initialize();
 
+            /// Get the number of bytes flushed to the display since boot, on the LVGL task only
+            static uint64_t get_flushed_bytes()
+            {
+                return flushed_bytes;
+            }
+
+            /// Get the number of command bytes sent to the display since boot, on the LVGL task only
+            static uint64_t get_command_bytes()
+            {
+                return command_bytes;
+            }
+
+            /// Set the columns of the screen that scroll in hardware, landscape only
+            /// \param x1 The first column
+            /// \param x2 The last column
+            /// \return true if the columns scroll, false if they can't
+            bool set_scroll_area(lv_coord_t x1, lv_coord_t x2);
+
+            /// Scroll the content of an area left in hardware
+            /// \param area The area whose content scrolls, its columns are the scroll area
+            /// \param columns The number of columns to scroll by
+            void scroll_left(const lv_area_t& area, lv_coord_t columns);
+
+            /// Leave the hardware scrolling, the screen is redrawn
+            void clear_scroll_area();
+
+            /// Is an area of the screen scrolling in hardware
+            bool is_scrolling() const
+            {
+                return scrolling;
+            }
+
         private:
             /// The "C" style callback required by LittlevGL
             static void display_flush_cb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_map);
 
+            /// The "C" style callback LittlevGL calls when a refresh has been flushed
+            static void display_monitor_cb(lv_disp_drv_t* drv, uint32_t time, uint32_t px);
+
             /// Class function required by LittlevGL to flush the video display buffer (VDB)
             /// \param drv The Lvgl display driver
             /// \param area The area of the screen to flush the colors to
             /// \param color_map The pointer to the color_map (colors to flush to screen)
             void display_drv_flush(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_map);
 
+            /// Send an area of the screen to its frame memory address window
+            /// \param x1 The first column
+            /// \param y1 The first row
+            /// \param x2 The last column
+            /// \param y2 The last row
+            /// \param color_map The colors, the rows of the area one after the other
+            void send_area(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, lv_color_t* color_map);
+
+            /// Queue the pixel data of an address window, once the transfer before it is done
+            /// \param x1 The first frame memory column
+            /// \param y1 The first frame memory row
+            /// \param x2 The last frame memory column
+            /// \param y2 The last frame memory row
+            /// \param data The pixel data
+            /// \param length The number of bytes
+            void queue_lines(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, lv_color_t* data, uint32_t length);
+
+            /// Wait for the transfer in flight to be done
+            void finish_transfer();
+
+            /// Get the bytes a number of pixels take over SPI
+            static uint32_t get_transfer_bytes(uint32_t pixels);
+
+            /// Log the time of a refresh of the whole screen
+            /// \param time_ms The time LittlevGL took to draw and flush the refresh
+            /// \param px The number of pixels refreshed
+            /// \param wait_us The time waited for its last transfer
+            void report_refresh(uint32_t time_ms, uint32_t px, int64_t wait_us);
+
+            /// A range of screen columns sent to one range of frame memory columns
+            struct Segment
+            {
+                lv_coord_t x;           // the first screen column
+                lv_coord_t memory_x;    // the screen column it is sent to, without scrolling
+                lv_coord_t width;
+            };
+
+            /// Split the columns of an area where the scroll offset wraps
+            /// \param x1 The first column
+            /// \param x2 The last column
+            /// \param segments The segments, left to right
+            /// \return The number of segments
+            int get_segments(lv_coord_t x1, lv_coord_t x2, Segment* segments) const;
+
+            /// Send the memory row shown first in the scroll area
+            void send_scroll_start();
+
+            /// Log the bytes sent for a scroll step once it has been redrawn
+            void report_scroll_step();
+
             /// Initialize the ST7735S display driver IC
             bool init_lcd_display();
 
@@ -63,11 +183,45 @@ namespace redstone
             static constexpr int LINES_TO_SEND = 40;                                            // See Note 2
             static constexpr int MAX_DMA_LEN = (LV_HOR_RES_MAX * LINES_TO_SEND * COLOR_SIZE);   // See Note 3
 
+            // Draw into two buffers, set to false to measure the single buffered flush
+            static constexpr bool DOUBLE_BUFFERED = true;
+
+            // Send 12 bit pixels, a quarter fewer bytes for 4 bits per color instead of 5-6-5
+            static constexpr bool RGB444_TRANSFER = false;
+            static constexpr uint8_t COLMOD_12_BIT = 0x03;
+            static_assert(!RGB444_TRANSFER || (COLOR_SIZE == 2 && LV_COLOR_16_SWAP),
+                          "The RGB444 packer takes big endian RGB565 pixels");
+
+            // The frame memory rows of the ST7735S, the axis it scrolls along
+            static constexpr int MEMORY_ROWS = 162;
+
+            // The CASET, RASET and RAMWR commands of an address window
+            static constexpr int ADDRESS_WINDOW_BYTES = 11;
+
             std::unique_ptr<smooth::application::display::LCDSpi> lcd_display{};
             bool display_initialized{ false };
+            bool first_frame_flushed{ false };
+            bool double_buffered{ false };
+            bool transfer_pending{ false };
+            uint32_t flush_transfers{ 0 };
+            int64_t flush_wait_us{ 0 };
+            static uint64_t flushed_bytes;
+            static uint64_t command_bytes;
+
+            bool scrolling{ false };
+            lv_coord_t scroll_x1{ 0 };
+            lv_coord_t scroll_x2{ 0 };
+            lv_coord_t scroll_offset{ 0 };      // the columns the content has moved left
+            uint16_t top_fixed_rows{ 0 };
+            bool scroll_step_pending{ false };
+            uint64_t flushed_at_scroll_step{ 0 };
+            uint64_t commands_at_scroll_step{ 0 };
+            uint32_t scroll_step_software_bytes{ 0 };
 
             smooth::core::io::spi::SpiDmaFixedBuffer<uint8_t, MAX_DMA_LEN> video_display_buffer1{};
+            smooth::core::io::spi::SpiDmaFixedBuffer<uint8_t, MAX_DMA_LEN> video_display_buffer2{};
             lv_color1_t* vdb1;
+            lv_color1_t* vdb2{ nullptr };
             lv_disp_buf_t disp_buf;
             lv_disp_drv_t disp_drv;
     };
@@ -0,0 +1,109 @@
+/****************************************************************************************
+ * FlushStatistics.cpp - Histograms of the cost of the display flushes
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "gui/FlushStatistics.h"
+#include <smooth/core/logging/log.h>
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "FlushStats";
+
+    // Log a histogram on one line
+    static void log_histogram(const char* name, const char* unit, const Histogram& histogram)
+    {
+        Log::info(TAG, "{}: n={} min={}{} avg={}{} p50<={}{} p90<={}{} p99<={}{} max={}{}",
+                  name, histogram.get_count(),
+                  histogram.get_min(), unit,
+                  histogram.get_mean(), unit,
+                  histogram.get_percentile(50), unit,
+                  histogram.get_percentile(90), unit,
+                  histogram.get_percentile(99), unit,
+                  histogram.get_max(), unit);
+    }
+
+    // Get the statistics
+    FlushStatistics& FlushStatistics::instance()
+    {
+        static FlushStatistics flush_statistics;
+
+        return flush_statistics;
+    }
+
+    // LittlevGL is about to run its tasks, a refresh draws from now
+    void FlushStatistics::handler_started(int64_t now_us)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        drawing_since_us = now_us;
+    }
+
+    // A flush started, the time since the last flush or the start of the handler was drawing
+    void FlushStatistics::flush_started(int64_t now_us)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        statistics.render_us.add(static_cast<uint32_t>(now_us - drawing_since_us));
+    }
+
+    // A flush finished, LittlevGL draws the next area from now
+    void FlushStatistics::flush_finished(int64_t now_us, uint32_t area_px, uint32_t bytes, uint32_t transfers,
+                                         int64_t dma_wait_us)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        statistics.area_px.add(area_px);
+        statistics.bytes.add(bytes);
+        statistics.transfers.add(transfers);
+        statistics.dma_wait_us.add(static_cast<uint32_t>(dma_wait_us));
+        drawing_since_us = now_us;
+    }
+
+    // A refresh finished
+    void FlushStatistics::frame_finished(int64_t dma_wait_us)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        statistics.frames += 1;
+        statistics.frame_wait_us.add(static_cast<uint32_t>(dma_wait_us));
+    }
+
+    // Get a copy of the histograms
+    FlushStatistics::Snapshot FlushStatistics::get_snapshot()
+    {
+        std::lock_guard<std::mutex> lock(guard);
+
+        return statistics;
+    }
+
+    // Log the histograms and clear them
+    void FlushStatistics::dump()
+    {
+        Snapshot snapshot;
+
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            snapshot = statistics;
+            statistics = Snapshot{};
+        }
+
+        Log::info(TAG, "Display: {} frames, {} flushes", snapshot.frames, snapshot.area_px.get_count());
+        log_histogram("area", "px", snapshot.area_px);
+        log_histogram("bytes", "B", snapshot.bytes);
+        log_histogram("send_lines", "", snapshot.transfers);
+        log_histogram("dma wait", "us", snapshot.dma_wait_us);
+        log_histogram("render", "us", snapshot.render_us);
+        log_histogram("frame end wait", "us", snapshot.frame_wait_us);
+    }
+}
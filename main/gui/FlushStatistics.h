@@ -0,0 +1,91 @@
+/****************************************************************************************
+ * FlushStatistics.h - Histograms of the cost of the display flushes
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Every flush of an area records:
+//      area        the pixels of the area LittlevGL drew
+//      bytes       the pixel bytes sent over SPI
+//      transfers   the send_lines() of the area, more than one when it is split
+//      dma wait    the time the flush waited for the transfer before it
+//      render      the time LittlevGL drew the area, since the flush before it or since
+//                  the LvglTask called lv_task_handler()
+//  and every refresh the time its last transfer was waited for.
+//
+//  The flushes are recorded on the LvglTask and read by the App, so a mutex guards the
+//  histograms.  get_snapshot() copies them, dump() logs and clears them.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include "model/Histogram.h"
+
+namespace redstone
+{
+    class FlushStatistics
+    {
+        public:
+            /// The histograms since the last dump
+            struct Snapshot
+            {
+                uint32_t frames{ 0 };
+                Histogram area_px;
+                Histogram bytes;
+                Histogram transfers;
+                Histogram dma_wait_us;
+                Histogram render_us;
+                Histogram frame_wait_us;
+            };
+
+            /// Get the statistics
+            static FlushStatistics& instance();
+
+            /// LittlevGL is about to run its tasks
+            /// \param now_us The current time in microseconds
+            void handler_started(int64_t now_us);
+
+            /// A flush started, LittlevGL has drawn its area
+            /// \param now_us The current time in microseconds
+            void flush_started(int64_t now_us);
+
+            /// A flush finished
+            /// \param now_us The current time in microseconds
+            /// \param area_px The pixels of the area
+            /// \param bytes The pixel bytes sent
+            /// \param transfers The number of send_lines()
+            /// \param dma_wait_us The time waited for the transfer before
+            void flush_finished(int64_t now_us, uint32_t area_px, uint32_t bytes, uint32_t transfers, int64_t dma_wait_us);
+
+            /// A refresh finished
+            /// \param dma_wait_us The time waited for its last transfer
+            void frame_finished(int64_t dma_wait_us);
+
+            /// Get a copy of the histograms
+            Snapshot get_snapshot();
+
+            /// Log the histograms and clear them
+            void dump();
+
+        private:
+            /// Constructor
+            FlushStatistics() = default;
+
+            std::mutex guard{};
+            Snapshot statistics{};
+            int64_t drawing_since_us{ 0 };
+    };
+}
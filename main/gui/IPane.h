@@ -19,6 +19,8 @@
 
 namespace redstone
 {
+    class IMailbox;
+
     class IPane
     {
         public:
@@ -29,5 +31,8 @@ namespace redstone
             virtual void hide() = 0;
 
             virtual void create(int width, int height) = 0;
+
+            /// The mailbox of the pane, paused while the pane is hidden, nullptr without one
+            virtual IMailbox* get_mailbox() { return nullptr; }
     };
 }
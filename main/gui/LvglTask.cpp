@@ -15,6 +15,9 @@
  * Licensed under MIT License
  ***************************************************************************************/
 #include "gui/LvglTask.h"
+#include <esp_timer.h>
+#include "gui/FlushStatistics.h"
+#include "model/Timeline.h"
 
 using namespace std::chrono;
 using namespace smooth::core;
@@ -41,13 +44,16 @@ namespace redstone
     void LvglTask::init()
     {
         Log::info(TAG, "initializing LvglTask");
+        Timeline::instance().name_task("LvglTask");
         view_controller.init();
     }
 
     // The task tick event that happens every 100ms
     void LvglTask::tick()
     {
-        // Let LittlevGL do some work
+        // Let LittlevGL do some work, a refresh draws from now
+        FlushStatistics::instance().handler_started(esp_timer_get_time());
+        TimelineScope scope(TimelineKind::Render, "lv_task_handler");
         lv_task_handler();
     }
 }
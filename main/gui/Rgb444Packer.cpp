@@ -0,0 +1,55 @@
+/****************************************************************************************
+ * Rgb444Packer.cpp - Packs RGB565 pixels into the 12 bit pixels of the ST7735S
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "gui/Rgb444Packer.h"
+
+namespace redstone
+{
+    // Get the 12 bits RRRRGGGGBBBB of an RGB565 pixel, the highest 4 bits of each color
+    static inline uint32_t to_rgb444(uint32_t pixel)
+    {
+        return ((pixel >> 4) & 0xF00) | ((pixel >> 3) & 0x0F0) | ((pixel >> 1) & 0x00F);
+    }
+
+    // Pack big endian RGB565 pixels into 12 bit pixels in place, two pixels to three bytes
+    size_t pack_rgb444(uint8_t* data, size_t pixels)
+    {
+        const uint8_t* in = data;
+        uint8_t* out = data;
+
+        for (size_t pair = 0; pair < pixels / 2; pair++)
+        {
+            uint32_t word = (static_cast<uint32_t>(in[0]) << 24) | (static_cast<uint32_t>(in[1]) << 16) |
+                            (static_cast<uint32_t>(in[2]) << 8) | in[3];
+            uint32_t packed = (to_rgb444(word >> 16) << 12) | to_rgb444(word & 0xFFFF);
+
+            out[0] = static_cast<uint8_t>(packed >> 16);
+            out[1] = static_cast<uint8_t>(packed >> 8);
+            out[2] = static_cast<uint8_t>(packed);
+            in += 4;
+            out += 3;
+        }
+
+        if (pixels % 2 != 0)
+        {
+            uint32_t last = to_rgb444((static_cast<uint32_t>(in[0]) << 8) | in[1]);
+            out[0] = static_cast<uint8_t>(last >> 4);
+            out[1] = static_cast<uint8_t>(last << 4);
+        }
+
+        return get_rgb444_size(pixels);
+    }
+}
@@ -0,0 +1,47 @@
+/****************************************************************************************
+ * Rgb444Packer.h - Packs RGB565 pixels into the 12 bit pixels of the ST7735S
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  With COLMOD 0x03 the ST7735S takes 12 bit pixels, two in three bytes:
+//
+//      R1 G1 | B1 R2 | G2 B2       4 bits each
+//
+//  The pixels are the big endian RGB565 LittlevGL draws with LV_COLOR_16_SWAP, each
+//  color keeps its highest 4 bits.  Two pixels are read as one 32 bit word and written
+//  as three bytes, in place: the three bytes of a pair never reach past the four it was
+//  read from, so the buffer being flushed is packed without a copy.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace redstone
+{
+    /// Get the bytes of a number of 12 bit pixels, an odd last pixel takes two bytes
+    /// \param pixels The number of pixels
+    inline size_t get_rgb444_size(size_t pixels)
+    {
+        return pixels / 2 * 3 + (pixels % 2) * 2;
+    }
+
+    /// Pack big endian RGB565 pixels into 12 bit pixels in place
+    /// \param data The pixels, two bytes each, the packed pixels on return
+    /// \param pixels The number of pixels
+    /// \return The number of bytes of the packed pixels
+    size_t pack_rgb444(uint8_t* data, size_t pixels);
+}
@@ -22,6 +22,9 @@
 #include "gui/CPAxpPmu2.h"
 #include "gui/CPAxpPmu3.h"
 #include "gui/CPBmp280.h"
+#include "gui/CPTrend.h"
+#include "gui/CPEventLog.h"
+#include "model/ConflatingMailbox.h"
 
 #include <smooth/core/logging/log.h>
 
@@ -74,6 +77,10 @@ namespace redstone
         title_pane = std::make_unique<TitlePane>("BMP280");
         title_pane->create(LV_HOR_RES, 20);
         title_panes[Bmp280] = std::move(title_pane);
+
+        title_pane = std::make_unique<TitlePane>("Pressure  40 min");
+        title_pane->create(LV_HOR_RES, 20);
+        title_panes[PressureTrend] = std::move(title_pane);
     
        
         title_pane = std::make_unique<TitlePane>("AxpPMU #1");
@@ -100,6 +107,10 @@ namespace redstone
         content_pane = std::make_unique<CPBmp280>(task_lvgl);
         content_pane->create(LV_HOR_RES, 58);
         content_panes[Bmp280] = std::move(content_pane); 
+
+        content_pane = std::make_unique<CPTrend>(task_lvgl, SeriesField::Pressure, 40);
+        content_pane->create(LV_HOR_RES, 58);
+        content_panes[PressureTrend] = std::move(content_pane);
     
         content_pane = std::make_unique<CPAxpPmu1>(task_lvgl);
         content_pane->create(LV_HOR_RES, 58);
@@ -112,23 +123,57 @@ namespace redstone
         content_pane = std::make_unique<CPAxpPmu3>(task_lvgl);
         content_pane->create(LV_HOR_RES, 58);
         content_panes[AxpPmu3] = std::move(content_pane);
+
+        // the event log scrolls the full height of the screen so it has no title pane
+        content_pane = std::make_unique<CPEventLog>(task_lvgl, display_driver);
+        content_pane->create(LV_HOR_RES, LV_VER_RES);
+        content_panes[EventLog] = std::move(content_pane);
     
         // show new view
+        // only the mailbox of the view shown wakes the LvglTask
+        for (auto& content_pane : content_panes)
+        {
+            if (content_pane.second->get_mailbox() != nullptr)
+            {
+                content_pane.second->get_mailbox()->pause();
+            }
+        }
+
         show_new_view();
     }
 
     // Show new view
     void ViewController::show_new_view()
     {
-        title_panes[new_view_id]->show();
+        if (title_panes.count(new_view_id) > 0)
+        {
+            title_panes[new_view_id]->show();
+        }
+
         content_panes[new_view_id]->show();
+
+        // the pane gets the value published while it was hidden
+        if (content_panes[new_view_id]->get_mailbox() != nullptr)
+        {
+            content_panes[new_view_id]->get_mailbox()->resume();
+        }
+
         current_view_id = new_view_id;
     }
 
     // Hide current view
     void ViewController::hide_current_view()
     {
-        title_panes[current_view_id]->hide();
+        if (title_panes.count(current_view_id) > 0)
+        {
+            title_panes[current_view_id]->hide();
+        }
+
+        if (content_panes[current_view_id]->get_mailbox() != nullptr)
+        {
+            content_panes[current_view_id]->get_mailbox()->pause();
+        }
+
         content_panes[current_view_id]->hide();
     }
 
@@ -136,7 +181,7 @@ namespace redstone
     void ViewController::show_next_view()
     {
         hide_current_view();
-        new_view_id = current_view_id == AxpPmu3 ? Temp : static_cast<ViewID>(static_cast<int>(current_view_id) + 1);
+        new_view_id = current_view_id == EventLog ? Temp : static_cast<ViewID>(static_cast<int>(current_view_id) + 1);
         show_new_view();
     }
 
@@ -144,7 +189,7 @@ namespace redstone
     void ViewController::show_prev_view()
     {
         hide_current_view();
-        new_view_id = current_view_id == Temp ? AxpPmu3 : static_cast<ViewID>(static_cast<int>(current_view_id) - 1);
+        new_view_id = current_view_id == Temp ? EventLog : static_cast<ViewID>(static_cast<int>(current_view_id) - 1);
         show_new_view();
     }
 
@@ -39,9 +39,11 @@ namespace redstone
                 Temp = 0,
                 Humidity,
                 Bmp280,
+                PressureTrend,
                 AxpPmu1,
                 AxpPmu2,
-                AxpPmu3
+                AxpPmu3,
+                EventLog
             };
 
             // Constructor
@@ -0,0 +1,77 @@
+/****************************************************************************************
+ * AppEvent.h - An application event, an alarm or a sensor fault, published to the views
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+namespace redstone
+{
+    class AppEvent
+    {
+        public:
+            /// The kinds of event
+            enum class Kind : uint8_t
+            {
+                Alarm,
+                SensorFault
+            };
+
+            AppEvent() {}
+
+            /// Constructor
+            /// \param kind The kind of event
+            /// \param source What raised the event, a string that lives for the program
+            /// \param timestamp_us The time of the event in microseconds since boot
+            AppEvent(Kind kind, const char* source, int64_t timestamp_us)
+                    : kind(kind), source(source), timestamp_us(timestamp_us)
+            {
+            }
+
+            /// Get the kind of event
+            /// \param return Return the kind
+            Kind get_kind() const
+            {
+                return kind;
+            }
+
+            /// Get the name of the kind of event
+            /// \param return Return the name
+            const char* get_kind_name() const
+            {
+                return kind == Kind::Alarm ? "Alarm" : "Fault";
+            }
+
+            /// Get what raised the event
+            /// \param return Return the source
+            const char* get_source() const
+            {
+                return source;
+            }
+
+            /// Get the time of the event
+            /// \param return Return the time in microseconds since boot
+            int64_t get_timestamp_us() const
+            {
+                return timestamp_us;
+            }
+
+        private:
+            Kind kind{ Kind::Alarm };
+            const char* source{ "" };
+            int64_t timestamp_us{ 0 };
+    };
+}
@@ -0,0 +1,77 @@
+/****************************************************************************************
+ * Axp192.cpp - The AXP192 PMU with a block read of the ADC registers
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/Axp192.h"
+
+using namespace smooth::application::sensor;
+
+namespace redstone
+{
+    // Constructor
+    Axp192::Axp192(i2c_port_t port, uint8_t address, std::mutex& guard) : AxpPMU(port, address, guard)
+    {
+    }
+
+    // Read the ADC register block and the coulomb counter block
+    bool Axp192::read_adc_block(AxpValue& value)
+    {
+        bool res = read(address, ADC_BLOCK_START, adc_block);
+        res = res && read(address, COULOMB_BLOCK_START, coulomb_block);
+
+        if (res)
+        {
+            // offset of a register in adc_block
+            auto reg = [this](uint8_t axp_register) -> uint32_t {
+                           return adc_block[axp_register - ADC_BLOCK_START];
+                       };
+
+            auto bits12 = [&reg](uint8_t msb_register) -> uint32_t {
+                              return (reg(msb_register) << 4) | (reg(msb_register + 1) & 0x0F);
+                          };
+
+            auto bits13 = [&reg](uint8_t msb_register) -> uint32_t {
+                              return (reg(msb_register) << 5) | (reg(msb_register + 1) & 0x1F);
+                          };
+
+            value.set_acin_voltage(bits12(0x56) * 1.7f / 1000.0f);
+            value.set_acin_current(bits12(0x58) * 0.625f);
+            value.set_vbus_voltage(bits12(0x5A) * 1.7f / 1000.0f);
+            value.set_vbus_current(bits12(0x5C) * 0.375f);
+            value.set_axp_device_temperature(bits12(0x5E) * 0.1f - 144.7f);
+            value.set_ts_pin_voltage(bits12(0x62) * 0.8f / 1000.0f);
+
+            uint32_t battery_power = (reg(0x70) << 16) | (reg(0x71) << 8) | reg(0x72);
+            value.set_battery_power(battery_power * 1.1f * 0.5f / 1000.0f);
+
+            value.set_battery_voltage(bits12(0x78) * 1.1f / 1000.0f);
+            value.set_battery_charging_current(bits13(0x7A) * 0.5f);
+            value.set_battery_discharging_current(bits13(0x7C) * 0.5f);
+            value.set_aps_voltage(bits12(0x7E) * 1.4f / 1000.0f);
+
+            uint32_t charge_count = (static_cast<uint32_t>(coulomb_block[0]) << 24)
+                                    | (coulomb_block[1] << 16) | (coulomb_block[2] << 8) | coulomb_block[3];
+
+            uint32_t discharge_count = (static_cast<uint32_t>(coulomb_block[4]) << 24)
+                                       | (coulomb_block[5] << 16) | (coulomb_block[6] << 8) | coulomb_block[7];
+
+            // capacity mAh = 65536 * 0.5mA * (charge - discharge) / 3600s / adc sample rate
+            auto coulomb_delta = static_cast<float>(static_cast<int32_t>(charge_count - discharge_count));
+            value.set_battery_capacity(65536.0f * 0.5f * coulomb_delta / 3600.0f / ADC_SAMPLE_RATE_HZ);
+        }
+
+        return res;
+    }
+}
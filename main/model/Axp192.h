@@ -0,0 +1,84 @@
+/****************************************************************************************
+ * Axp192.h - The AXP192 PMU with a block read of the ADC registers
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The AxpPMU getters each perform a complete I2C transaction (start, address, register,
+//  restart, read, stop) for a single measurement. The AXP192 ADC results are stored in
+//  a contiguous register block (0x56 - 0x7F) and the coulomb counters in a second block
+//  (0xB0 - 0xB7), so all of the AxpValue measurements can be read with two transactions.
+//
+//  Register block 0x56 - 0x7F
+//      0x56-0x57   ACIN voltage            12 bits     1.7mV/lsb
+//      0x58-0x59   ACIN current            12 bits     0.625mA/lsb
+//      0x5A-0x5B   VBUS voltage            12 bits     1.7mV/lsb
+//      0x5C-0x5D   VBUS current            12 bits     0.375mA/lsb
+//      0x5E-0x5F   AXP internal temp       12 bits     0.1C/lsb, offset -144.7C
+//      0x62-0x63   TS pin voltage          12 bits     0.8mV/lsb
+//      0x70-0x72   Battery power           24 bits     1.1mV * 0.5mA/lsb
+//      0x78-0x79   Battery voltage         12 bits     1.1mV/lsb
+//      0x7A-0x7B   Battery charge current  13 bits     0.5mA/lsb
+//      0x7C-0x7D   Battery dischg current  13 bits     0.5mA/lsb
+//      0x7E-0x7F   APS voltage             12 bits     1.4mV/lsb
+//
+//  Register block 0xB0 - 0xB7
+//      0xB0-0xB3   Battery charge coulomb counter      32 bits
+//      0xB4-0xB7   Battery discharge coulomb counter   32 bits
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <mutex>
+#include <smooth/application/io/i2c/AxpPMU.h>
+#include <smooth/core/util/FixedBuffer.h>
+#include "model/AxpValue.h"
+
+namespace redstone
+{
+    class Axp192 : public smooth::application::sensor::AxpPMU
+    {
+        public:
+            /// Constructor
+            /// \param port The I2C port
+            /// \param address The I2C address of the AXP192
+            /// \param guard The I2C bus mutex
+            Axp192(i2c_port_t port, uint8_t address, std::mutex& guard);
+
+            /// Read all the ADC measurements in two I2C transactions
+            /// \param value The AxpValue to fill in with the measurements
+            /// \return true on success, false on failure
+            bool read_adc_block(AxpValue& value);
+
+            /// Number of I2C transactions performed by read_adc_block()
+            static constexpr uint32_t BLOCK_READ_TRANSACTIONS = 2;
+
+            /// Number of I2C transactions performed when using the AxpPMU getters; eleven
+            /// getters read one register group each and get_battery_capacity reads both
+            /// coulomb counters.
+            static constexpr uint32_t REGISTER_READ_TRANSACTIONS = 13;
+
+        private:
+            static constexpr uint8_t ADC_BLOCK_START = 0x56;
+            static constexpr uint8_t ADC_BLOCK_END = 0x7F;
+            static constexpr uint8_t COULOMB_BLOCK_START = 0xB0;
+            static constexpr uint8_t COULOMB_BLOCK_END = 0xB7;
+
+            // ADC sample rate is set to 200Hz in Reg84H_Adc_Sample_Rate, see Axp192Init.h
+            static constexpr float ADC_SAMPLE_RATE_HZ = 200.0f;
+
+            smooth::core::util::FixedBuffer<uint8_t, ADC_BLOCK_END - ADC_BLOCK_START + 1> adc_block{};
+            smooth::core::util::FixedBuffer<uint8_t, COULOMB_BLOCK_END - COULOMB_BLOCK_START + 1> coulomb_block{};
+    };
+}
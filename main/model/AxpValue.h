@@ -17,6 +17,7 @@
 #pragma once
 
 #include <string>
+#include <cstdint>
 #include <math.h>
 
 namespace redstone
@@ -194,6 +195,34 @@ namespace redstone
                 return battery_capacity;
             }
 
+            /// Set the time the value was published
+            /// \param value The time in microseconds since boot
+            void set_timestamp_us(int64_t value)
+            {
+                timestamp_us = value;
+            }
+
+            /// Get the time the value was published
+            /// \param return Return the time in microseconds since boot
+            int64_t get_timestamp_us() const
+            {
+                return timestamp_us;
+            }
+
+            /// Set the sequence number, incremented each time a value is published
+            /// \param value The sequence number
+            void set_sequence(uint32_t value)
+            {
+                sequence = value;
+            }
+
+            /// Get the sequence number
+            /// \param return Return the sequence number
+            uint32_t get_sequence() const
+            {
+                return sequence;
+            }
+
         private:
             float acin_voltage;
             float acin_current;
@@ -207,5 +236,7 @@ namespace redstone
             float battery_discharging_current;
             float battery_capacity;
             float battery_power;
+            int64_t timestamp_us{ 0 };
+            uint32_t sequence{ 0 };
     };
 }
@@ -0,0 +1,130 @@
+/****************************************************************************************
+ * Bmp280Profile.h - Named BMP280 measurement profiles
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  A profile sets the mode, oversampling, standby time and IIR filter of the BMP280
+//  together.  The conversion time and average current are estimated from the BMP280
+//  datasheet (section 3.8):
+//
+//      typical conversion time = 1.0 + 2.0 * osrs_t + 2.0 * osrs_p + 0.5 ms
+//      maximum conversion time = 1.25 + 2.3 * osrs_t + 2.3 * osrs_p + 0.575 ms
+//
+//  The average current assumes about 0.5mA while converting and 0.1uA while sleeping;
+//  this matches the datasheet 2.74uA for ultra low power at 1Hz.  In forced mode one
+//  conversion is made per read, in normal mode the sensor converts continuously with the
+//  standby time between conversions.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <smooth/application/io/i2c/BME280.h>
+
+namespace redstone
+{
+    struct Bmp280Profile
+    {
+        using Core = smooth::application::sensor::BME280Core;
+
+        const char* name;
+        Core::SensorMode mode;
+        Core::OverSampling temperature_oversampling;
+        Core::OverSampling pressure_oversampling;
+        Core::StandbyTimeMS standby_time;
+        Core::FilterCoeff filter;
+        int temperature_samples;        // the oversampling as a number of samples
+        int pressure_samples;           // the oversampling as a number of samples
+        float standby_ms;               // the standby time in milliseconds, normal mode only
+
+        /// Typical conversion time in milliseconds
+        constexpr float typical_conversion_ms() const
+        {
+            return 1.0f + 2.0f * temperature_samples + 2.0f * pressure_samples + 0.5f;
+        }
+
+        /// Maximum conversion time in milliseconds, the time to wait after a forced conversion
+        constexpr float max_conversion_ms() const
+        {
+            return 1.25f + 2.3f * temperature_samples + 2.3f * pressure_samples + 0.575f;
+        }
+
+        /// Is the profile using forced mode
+        constexpr bool is_forced() const
+        {
+            return mode == Core::SensorMode::Forced;
+        }
+
+        /// Estimated average current in uA
+        /// \param read_rate_hz The rate the sensor is read at
+        constexpr float average_current_uA(float read_rate_hz) const
+        {
+            float conversions_per_second = is_forced()
+                                           ? read_rate_hz
+                                           : 1000.0f / (typical_conversion_ms() + standby_ms);
+
+            return CONVERSION_CURRENT_UA * typical_conversion_ms() / 1000.0f * conversions_per_second
+                   + SLEEP_CURRENT_UA;
+        }
+
+        static constexpr float CONVERSION_CURRENT_UA = 500.0f;
+        static constexpr float SLEEP_CURRENT_UA = 0.1f;
+    };
+
+    enum class Bmp280ProfileId : int
+    {
+        UltraLowPowerForced = 0,
+        WeatherStation,
+        HighResolutionIndoor
+    };
+
+    static constexpr std::array<Bmp280Profile, 3> bmp280_profiles =
+    { {
+        // Ultra low power - one x1 conversion per read, no filter
+        { "ultra-low-power forced",
+          Bmp280Profile::Core::SensorMode::Forced,
+          Bmp280Profile::Core::OverSampling::Oversamplingx1,
+          Bmp280Profile::Core::OverSampling::Oversamplingx1,
+          Bmp280Profile::Core::StandbyTimeMS::ST_1000,
+          Bmp280Profile::Core::FilterCoeff::FC_OFF,
+          1, 1, 1000.0f },
+
+        // Weather station - standard resolution pressure, light filtering, 1 second standby
+        { "weather station",
+          Bmp280Profile::Core::SensorMode::Normal,
+          Bmp280Profile::Core::OverSampling::Oversamplingx1,
+          Bmp280Profile::Core::OverSampling::Oversamplingx4,
+          Bmp280Profile::Core::StandbyTimeMS::ST_1000,
+          Bmp280Profile::Core::FilterCoeff::FC_4,
+          1, 4, 1000.0f },
+
+        // High resolution indoor - ultra high resolution pressure, strong filtering
+        { "high-resolution indoor",
+          Bmp280Profile::Core::SensorMode::Normal,
+          Bmp280Profile::Core::OverSampling::Oversamplingx2,
+          Bmp280Profile::Core::OverSampling::Oversamplingx16,
+          Bmp280Profile::Core::StandbyTimeMS::ST_500,
+          Bmp280Profile::Core::FilterCoeff::FC_16,
+          2, 16, 500.0f }
+    } };
+
+    /// Get a BMP280 profile
+    /// \param id The profile id
+    /// \return The profile
+    inline const Bmp280Profile& get_bmp280_profile(Bmp280ProfileId id)
+    {
+        return bmp280_profiles[static_cast<size_t>(id)];
+    }
+}
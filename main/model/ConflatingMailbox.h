@@ -0,0 +1,291 @@
+/****************************************************************************************
+ * ConflatingMailbox.h - A subscription that only holds the latest published value
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The counterpart of a SubscribingTaskEventQueue for values where only the newest one
+//  matters, the state of a sensor.  A queue of 2 either holds a stale value behind the
+//  newest or drops the newest when the subscriber's task is slow, a mailbox only ever
+//  delivers the latest value.
+//
+//  A publish writes the value once into the SnapshotChannel of T, the mailboxes hold no
+//  copy of it.  The first publish after a delivery pushes a MailboxSignal into a
+//  TaskEventQueue of 1 registered with the subscriber's task, so the task is woken once
+//  however many values arrive before it runs.  It then reads the channel and gives the
+//  listener the latest value.  A value replaced before it was delivered is counted as
+//  dropped, and the time from its publish to its delivery, the staleness, goes into a
+//  histogram.
+//
+//  A mailbox is paused while its subscriber has nothing to show, the content pane of a
+//  hidden view.  A publish then only counts the value as skipped and does not wake the
+//  task, and resume() gives the listener the latest value if it has not had it yet, so
+//  a pane shown again is current without waiting for the next publish.
+//
+//  ConflatingMailbox<T>::publish() fills the channel, signals the mailboxes of T and
+//  publishes to the subscribing queues of T, so a publisher serves all of them with one
+//  call.  dump() logs and clears the statistics of every mailbox of T.
+//
+//  SignalQueue is the queue that wakes the task, a TaskEventQueue of MailboxSignal.  The
+//  host tool SnapshotBench replaces it with a stand-in to time the publish path without
+//  running tasks.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>  // for shared pointer
+#include <mutex>
+#include <vector>
+#include <esp_timer.h>
+#include <smooth/core/Task.h>
+#include <smooth/core/ipc/IEventListener.h>
+#include <smooth/core/ipc/Publisher.h>
+#include <smooth/core/ipc/TaskEventQueue.h>
+#include <smooth/core/logging/log.h>
+#include "model/Histogram.h"
+#include "model/SnapshotChannel.h"
+#include "model/Timeline.h"
+
+namespace redstone
+{
+    /// Wakes the task of a mailbox, the value is in the SnapshotChannel
+    struct MailboxSignal
+    {
+    };
+
+    /// The pause and resume of a mailbox, whatever the type of its values
+    class IMailbox
+    {
+        public:
+            virtual ~IMailbox() = default;
+
+            /// Stop waking the task of the mailbox for published values
+            virtual void pause() = 0;
+
+            /// Wake the task again, the latest value is delivered if it was not yet - called by
+            /// the task the listener runs under
+            virtual void resume() = 0;
+    };
+
+    template<typename T, typename SignalQueue = smooth::core::ipc::TaskEventQueue<MailboxSignal>>
+    class ConflatingMailbox : public smooth::core::ipc::IEventListener<MailboxSignal>, public IMailbox
+    {
+        public:
+            /// The deliveries since the last dump
+            struct Statistics
+            {
+                uint32_t delivered{ 0 };
+                uint32_t dropped{ 0 };
+                uint32_t skipped{ 0 };
+                Histogram staleness_us;
+            };
+
+            /// Create a mailbox subscribed to the published values of T
+            /// \param name The name of the subscriber in the statistics, a string literal
+            /// \param task The task the listener runs under
+            /// \param listener The instance that will receive the latest value
+            static std::shared_ptr<ConflatingMailbox> create(const char* name, smooth::core::Task& task,
+                                                             smooth::core::ipc::IEventListener<T>& listener)
+            {
+                std::shared_ptr<ConflatingMailbox> mailbox(new ConflatingMailbox(name, task, listener));
+
+                std::lock_guard<std::mutex> lock(get_registry_guard());
+                get_mailboxes().push_back(mailbox.get());
+
+                return mailbox;
+            }
+
+            /// Destructor, the mailbox is unsubscribed
+            ~ConflatingMailbox() override
+            {
+                std::lock_guard<std::mutex> lock(get_registry_guard());
+                auto& mailboxes = get_mailboxes();
+                mailboxes.erase(std::remove(mailboxes.begin(), mailboxes.end(), this), mailboxes.end());
+            }
+
+            ConflatingMailbox(const ConflatingMailbox&) = delete;
+            ConflatingMailbox& operator=(const ConflatingMailbox&) = delete;
+
+            /// Publish a value to the mailboxes and the subscribing queues of T - called only by
+            /// the task that publishes T, the one writer of its SnapshotChannel
+            /// \param item The value
+            static void publish(const T& item)
+            {
+                int64_t now_us = esp_timer_get_time();
+                SnapshotChannel<T>::instance().write(item);
+
+                {
+                    std::lock_guard<std::mutex> lock(get_registry_guard());
+
+                    for (auto* mailbox : get_mailboxes())
+                    {
+                        mailbox->post(now_us);
+                    }
+                }
+
+                smooth::core::ipc::Publisher<T>::publish(item);
+            }
+
+            /// Get a copy of the statistics
+            Statistics get_statistics()
+            {
+                std::lock_guard<std::mutex> lock(guard);
+
+                return statistics;
+            }
+
+            /// Log the statistics of every mailbox of T and clear them
+            static void dump()
+            {
+                std::lock_guard<std::mutex> lock(get_registry_guard());
+
+                for (auto* mailbox : get_mailboxes())
+                {
+                    Statistics s;
+
+                    {
+                        std::lock_guard<std::mutex> mailbox_lock(mailbox->guard);
+                        s = mailbox->statistics;
+                        mailbox->statistics = Statistics{};
+                    }
+
+                    smooth::core::logging::Log::info("Mailbox",
+                                                     "{}: delivered={} dropped={} skipped={} staleness avg={}us p90<={}us max={}us",
+                                                     mailbox->name, s.delivered, s.dropped, s.skipped,
+                                                     s.staleness_us.get_mean(),
+                                                     s.staleness_us.get_percentile(90), s.staleness_us.get_max());
+                }
+            }
+
+            /// Stop waking the task for published values
+            void pause() override
+            {
+                std::lock_guard<std::mutex> lock(guard);
+                paused = true;
+            }
+
+            /// Wake the task again and give the listener the latest value if it has not had it
+            void resume() override
+            {
+                {
+                    std::lock_guard<std::mutex> lock(guard);
+                    paused = false;
+                }
+
+                deliver();
+            }
+
+            /// The MailboxSignal event, the latest value is given to the listener
+            void event(const MailboxSignal& /*signal*/) override
+            {
+                deliver();
+            }
+
+        private:
+            /// Constructor
+            ConflatingMailbox(const char* name, smooth::core::Task& task, smooth::core::ipc::IEventListener<T>& listener) :
+                    name(name),
+                    listener(listener),
+                    signal_queue(SignalQueue::create(1, task, *this))
+            {
+            }
+
+            /// Give the listener the latest value, unless it has it or the mailbox is paused
+            void deliver()
+            {
+                T item;
+                bool is_new = false;
+
+                {
+                    std::lock_guard<std::mutex> lock(guard);
+                    full = false;
+
+                    // a signal pushed before the pause is left for resume()
+                    if (paused)
+                    {
+                        return;
+                    }
+
+                    uint32_t writes = SnapshotChannel<T>::instance().read(item);
+
+                    // a value written just before the last delivery may already have been read
+                    if (writes != delivered_writes)
+                    {
+                        is_new = true;
+                        delivered_writes = writes;
+                        statistics.delivered += 1;
+                        statistics.staleness_us.add(static_cast<uint32_t>(esp_timer_get_time() - published_us));
+                    }
+                }
+
+                if (is_new)
+                {
+                    TimelineScope scope(TimelineKind::Deliver, name);
+                    listener.event(item);
+                }
+            }
+
+            /// A value was published, the task is only signalled when the one before was delivered
+            /// and the mailbox is not paused
+            void post(int64_t now_us)
+            {
+                std::lock_guard<std::mutex> lock(guard);
+                published_us = now_us;
+
+                if (paused)
+                {
+                    statistics.skipped += 1;
+                }
+                else if (full)
+                {
+                    statistics.dropped += 1;
+                }
+                else
+                {
+                    // the value before was delivered, so the queue of 1 is empty
+                    full = signal_queue->push(MailboxSignal{});
+                }
+            }
+
+            /// The mailboxes of T
+            static std::vector<ConflatingMailbox*>& get_mailboxes()
+            {
+                static std::vector<ConflatingMailbox*> mailboxes;
+
+                return mailboxes;
+            }
+
+            /// The guard of the mailboxes of T
+            static std::mutex& get_registry_guard()
+            {
+                static std::mutex registry_guard;
+
+                return registry_guard;
+            }
+
+            const char* name;
+            smooth::core::ipc::IEventListener<T>& listener;
+
+            std::shared_ptr<SignalQueue> signal_queue;
+
+            std::mutex guard{};
+            int64_t published_us{ 0 };
+            uint32_t delivered_writes{ 0 };
+            bool full{ false };
+            bool paused{ false };
+            Statistics statistics{};
+    };
+}
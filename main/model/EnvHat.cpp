@@ -15,11 +15,11 @@
  * Licensed under MIT License
  ***************************************************************************************/
 #include "model/EnvHat.h"
-#include <smooth/core/ipc/Publisher.h>
+#include <esp_timer.h>
+#include <thread>
 
 using namespace std::chrono;
 using namespace smooth::core;
-using namespace smooth::core::ipc;
 using namespace smooth::application::sensor;
 
 namespace redstone
@@ -43,7 +43,12 @@ namespace redstone
     void EnvHat::initialize()
     {
         initialize_dht12();
-        initialize_bme280();
+
+        // the BMP280 is scanned, reset and configured by step_bmp280_bringup()
+        bmp280 = i2c1_master.create_device<BME280>(0x76);   // BMP280 i2c device address  0x76
+        bmp280_state = Bmp280State::Scan;
+        bmp280_state_start_us = -1;
+        bmp280_attempts = 0;
     }
 
     // Initialize the I2C DHT12 device
@@ -61,59 +66,243 @@ namespace redstone
         Log::info(TAG, "DHT12 initialization --- {}", dht12_initialized ? "Succeeded" : "Failed");
     }
 
-    // Initialize the I2C BMP280 device
-    void EnvHat::initialize_bme280()
+    // Perform the next step of the BMP280 bring-up
+    bool EnvHat::step_bmp280_bringup(int64_t now_us)
     {
-        auto device = i2c1_master.create_device<BME280>(0x76);   // BMP280 i2c device address  0x76
-        Log::info(TAG, "Scanning for BMP280 ---- {}", device->is_present() ? "device found" : "device NOT present");
+        bool measuring = false;
+        bool loading_from_nvm = false;
 
-        if (device->is_present())
+        if (bmp280_state == Bmp280State::Ready || bmp280_state == Bmp280State::Failed)
         {
-            bool measuring = false;
-            bool loading_from_nvm = false;
+            return true;
+        }
 
-            Log::info(TAG, "BMP280 reset: {}", device->reset());
+        if (bmp280_state_start_us < 0)
+        {
+            bmp280_state_start_us = now_us;
+        }
 
-            while (!device->read_status(measuring, loading_from_nvm) || loading_from_nvm)
-            {
-                Log::info(TAG, "Waiting for BMP280 to complete reset operation... {} {}", measuring, loading_from_nvm);
-            }
+        int64_t time_in_state_us = now_us - bmp280_state_start_us;
 
-            bmp280_initialized = device->configure_sensor(BME280Core::SensorMode::Normal,
-                                                          BME280Core::OverSampling::Oversamplingx1,
-                                                          BME280Core::OverSampling::Oversamplingx1,
-                                                          BME280Core::OverSampling::Oversamplingx1,
-                                                          BME280Core::StandbyTimeMS::ST_1000,
-                                                          BME280Core::FilterCoeff::FC_OFF);
+        switch (bmp280_state)
+        {
+            case Bmp280State::Scan:
+                if (bmp280->is_present())
+                {
+                    Log::info(TAG, "Scanning for BMP280 ---- device found");
+                    set_bmp280_state(Bmp280State::Reset, now_us);
+                }
+                else if (time_in_state_us > BMP280_SCAN_TIMEOUT_US)
+                {
+                    Log::info(TAG, "Scanning for BMP280 ---- device NOT present");
+                    set_bmp280_state(Bmp280State::Failed, now_us);
+                }
+                break;
 
-            if (bmp280_initialized)
-            {
-                bmp280 = std::move(device);
-            }
+            case Bmp280State::Reset:
+                bmp280_attempts += 1;
+
+                if (bmp280->reset())
+                {
+                    set_bmp280_state(Bmp280State::WaitReset, now_us);
+                }
+                else
+                {
+                    retry_bmp280_bringup("reset failed", now_us);
+                }
+                break;
+
+            case Bmp280State::WaitReset:
+                if (bmp280->read_status(measuring, loading_from_nvm) && !loading_from_nvm)
+                {
+                    set_bmp280_state(Bmp280State::Configure, now_us);
+                }
+                else if (time_in_state_us > BMP280_RESET_TIMEOUT_US)
+                {
+                    retry_bmp280_bringup("reset timed out", now_us);
+                }
+                break;
+
+            case Bmp280State::Configure:
+                // forced mode profiles are left sleeping until a read starts a conversion
+                if (configure_bmp280(get_bmp280_profile().is_forced()
+                                     ? BME280Core::SensorMode::Sleep
+                                     : get_bmp280_profile().mode))
+                {
+                    set_bmp280_state(Bmp280State::Ready, now_us);
+                    print_bmp280_profile();
+                }
+                else
+                {
+                    retry_bmp280_bringup("configure failed", now_us);
+                }
+                break;
+
+            case Bmp280State::Ready:
+            case Bmp280State::Failed:
+                break;
+        }
+
+        bool finished = bmp280_state == Bmp280State::Ready || bmp280_state == Bmp280State::Failed;
+
+        if (finished)
+        {
+            bmp280_initialized = bmp280_state == Bmp280State::Ready;
+            Log::info(TAG, "BMP280 initialization --- {}", bmp280_initialized ? "Succeeded" : "Failed");
         }
 
-        Log::info(TAG, "BMP280 initialization --- {}", bmp280_initialized ? "Succeeded" : "Failed");
+        return finished;
+    }
+
+    // Change the BMP280 bring-up state
+    void EnvHat::set_bmp280_state(Bmp280State state, int64_t now_us)
+    {
+        bmp280_state = state;
+        bmp280_state_start_us = now_us;
+    }
+
+    // Retry the BMP280 bring-up from the reset, or fail if out of attempts
+    void EnvHat::retry_bmp280_bringup(const char* reason, int64_t now_us)
+    {
+        Log::warning(TAG, "BMP280 {} on attempt {} of {}", reason, bmp280_attempts, BMP280_MAX_ATTEMPTS);
+        set_bmp280_state(bmp280_attempts < BMP280_MAX_ATTEMPTS ? Bmp280State::Reset : Bmp280State::Failed, now_us);
     }
 
     // Read measurements
     void EnvHat::read_measurements()
     {
+        read_dht12();
+        read_bmp280();
+        stamp_measurements();
+    }
+
+    // Read the DHT12 temperature and humidity
+    bool EnvHat::read_dht12()
+    {
+        bool res = false;
+
         if (dht12_initialized)
         {
             float temperature, humidity;
-            dht12->read_measurements(humidity, temperature);
-            envir_value.set_temperture_degree_C(temperature - T_COMP_CELSIUS);
-            envir_value.set_relative_humidity(humidity);
+            res = dht12->read_measurements(humidity, temperature);
+
+            if (res)
+            {
+                envir_value.set_temperture_degree_C(temperature - T_COMP_CELSIUS);
+                envir_value.set_relative_humidity(humidity);
+            }
+        }
+
+        return res;
+    }
+
+    // Read the BMP280 temperature and pressure, waiting for the conversion if required
+    bool EnvHat::read_bmp280()
+    {
+        int64_t conversion_us = start_measurement();
+
+        if (conversion_us > 0)
+        {
+            std::this_thread::sleep_for(microseconds(conversion_us));
+        }
+
+        return conversion_us >= 0 && collect_measurement();
+    }
+
+    // Start the BMP280 conversion
+    int64_t EnvHat::start_measurement()
+    {
+        int64_t conversion_us = -1;
+
+        if (bmp280_initialized)
+        {
+            const Bmp280Profile& profile = get_bmp280_profile();
+
+            // in forced mode a conversion is started, in normal mode the sensor is always converting
+            if (!profile.is_forced())
+            {
+                conversion_us = 0;
+            }
+            else if (configure_bmp280(BME280Core::SensorMode::Forced))
+            {
+                conversion_us = static_cast<int64_t>(profile.max_conversion_ms() * 1000);
+            }
         }
 
+        return conversion_us;
+    }
+
+    // Collect the BMP280 temperature and pressure
+    bool EnvHat::collect_measurement()
+    {
+        bool res = false;
+
         if (bmp280_initialized)
         {
             float temperature, humidity, pressure;
-            bmp280->read_measurements(humidity, pressure, temperature);
-            envir_value.set_bmp280_temperture_degree_C(temperature);
-            envir_value.set_pressure_hPa(pressure);
+            res = bmp280->read_measurements(humidity, pressure, temperature);
+
+            if (res)
+            {
+                envir_value.set_bmp280_temperture_degree_C(temperature);
+                envir_value.set_pressure_hPa(pressure);
+            }
         }
 
-        Publisher<EnvirValue>::publish(envir_value);
+        return res;
+    }
+
+    // Change the BMP280 measurement profile
+    bool EnvHat::set_bmp280_profile(Bmp280ProfileId id)
+    {
+        bool res = true;
+        bmp280_profile_id = id;
+
+        // only the ctrl_meas and config registers are written, no reset is required
+        if (bmp280_initialized)
+        {
+            res = configure_bmp280(get_bmp280_profile().is_forced()
+                                   ? BME280Core::SensorMode::Sleep
+                                   : get_bmp280_profile().mode);
+        }
+
+        print_bmp280_profile();
+
+        return res;
+    }
+
+    // Write the settings of the profile in use to the BMP280
+    bool EnvHat::configure_bmp280(Bmp280Profile::Core::SensorMode mode)
+    {
+        const Bmp280Profile& profile = get_bmp280_profile();
+
+        return bmp280->configure_sensor(mode,
+                                        BME280Core::OverSampling::Oversamplingx1,   // humidity, not on a BMP280
+                                        profile.pressure_oversampling,
+                                        profile.temperature_oversampling,
+                                        profile.standby_time,
+                                        profile.filter);
+    }
+
+    // Log the BMP280 profile in use
+    void EnvHat::print_bmp280_profile() const
+    {
+        const Bmp280Profile& profile = get_bmp280_profile();
+        float read_rate_hz = 1000.0f / duration_cast<milliseconds>(BMP280_SAMPLING.period).count();
+
+        Log::info(TAG, "BMP280 profile: {} - conversion typ {:.1f} ms max {:.1f} ms, current {:.1f} uA at {:.1f} Hz",
+                  profile.name,
+                  profile.typical_conversion_ms(),
+                  profile.max_conversion_ms(),
+                  profile.average_current_uA(read_rate_hz),
+                  read_rate_hz);
+    }
+
+    // Compute the derived values of the latest measurements and stamp them
+    void EnvHat::stamp_measurements()
+    {
+        envir_value.compute_derived_values();
+        envir_value.set_sequence(envir_value.get_sequence() + 1);
+        envir_value.set_timestamp_us(esp_timer_get_time());
     }
 }
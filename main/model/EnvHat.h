@@ -17,6 +17,8 @@
 #pragma once
 
 #include "model/EnvirValue.h"
+#include "model/SensorScheduler.h"
+#include "model/Bmp280Profile.h"
 #include <smooth/core/io/i2c/Master.h>
 #include <smooth/application/io/i2c/DHT12.h>
 #include <smooth/application/io/i2c/BME280.h>
@@ -26,27 +28,129 @@ namespace redstone
     class EnvHat
     {
         public:
+            /// The DHT12 can't deliver new measurements faster than about 0.5Hz
+            static constexpr SamplingSpec DHT12_SAMPLING{ std::chrono::seconds(2), std::chrono::milliseconds(0) };
+
+            /// The BMP280 is sampled at 1Hz, half way between the DHT12 reads on i2c1
+            static constexpr SamplingSpec BMP280_SAMPLING{ std::chrono::seconds(1), std::chrono::milliseconds(500) };
+
             /// Constructor
             EnvHat();
 
-            /// Initialize the Envir HAT
+            /// The interval between the steps of the BMP280 bring-up
+            static constexpr SamplingSpec BMP280_BRINGUP_SAMPLING{ std::chrono::milliseconds(10), std::chrono::milliseconds(0) };
+
+            /// Initialize the Envir HAT, the BMP280 bring-up is only started and must be
+            /// completed by calling step_bmp280_bringup()
             void initialize();
 
-            /// Read measurements for the Envir HAT
+            /// Perform the next step of the BMP280 bring-up, never waits on the device
+            /// \param now_us The current time in microseconds
+            /// \return true when the bring-up has finished, succeeded or failed
+            bool step_bmp280_bringup(int64_t now_us);
+
+            /// Read measurements for the Envir HAT and stamp them
             void read_measurements();
 
+            /// Read the DHT12 temperature and humidity
+            /// \return true on success, false if not initialized or the read failed
+            bool read_dht12();
+
+            /// Read the BMP280 temperature and pressure, waits for the conversion in forced mode
+            /// \return true on success, false if not initialized or the read failed
+            bool read_bmp280();
+
+            /// Start the BMP280 conversion, the first phase of a split-phase read. The DHT12
+            /// has no conversion trigger over I2C, each read returns the result of its own
+            /// conversion, so it is read in a single phase with read_dht12().
+            /// \return The time in microseconds until the result can be collected,
+            /// 0 if it can be collected now, -1 if not initialized or starting failed
+            int64_t start_measurement();
+
+            /// Collect the BMP280 temperature and pressure, the second phase of a split-phase read
+            /// \return true on success, false if not initialized or the read failed
+            bool collect_measurement();
+
+            /// Compute the derived values of the latest measurements and stamp them with the
+            /// time and a sequence number, they are published in the next SensorFrame
+            void stamp_measurements();
+
+            /// Get the latest measurements, as last stamped
+            const EnvirValue& get_envir_value() const
+            {
+                return envir_value;
+            }
+
+            /// Change the BMP280 measurement profile without resetting the device. Until
+            /// the bring-up has finished only the profile to configure is changed.
+            /// \param id The profile to use
+            /// \return true on success, false if configuring the device failed
+            bool set_bmp280_profile(Bmp280ProfileId id);
+
+            /// Get the BMP280 measurement profile in use
+            const Bmp280Profile& get_bmp280_profile() const
+            {
+                return redstone::get_bmp280_profile(bmp280_profile_id);
+            }
+
+            /// Log the BMP280 profile in use with its conversion time and current
+            void print_bmp280_profile() const;
+
+            /// Is the DHT12 initialized
+            bool is_dht12_initialized() const
+            {
+                return dht12_initialized;
+            }
+
+            /// Is the BMP280 initialized
+            bool is_bmp280_initialized() const
+            {
+                return bmp280_initialized;
+            }
+
         private:
             /// Initialize the DHT12 I2C device
             void initialize_dht12();
 
-            /// Initialize the BME280 I2C device
-            void initialize_bme280();
+            /// Write the settings of the profile in use to the BMP280
+            /// \param mode The sensor mode to write, forced mode starts a conversion
+            bool configure_bmp280(Bmp280Profile::Core::SensorMode mode);
+
+            /// The states of the BMP280 bring-up
+            enum class Bmp280State
+            {
+                Scan,               // check the device is present
+                Reset,              // send the soft reset
+                WaitReset,          // poll the status until NVM data is copied
+                Configure,          // set mode, oversampling, standby and filter
+                Ready,
+                Failed
+            };
+
+            /// Change the BMP280 bring-up state
+            /// \param state The new state
+            /// \param now_us The current time in microseconds
+            void set_bmp280_state(Bmp280State state, int64_t now_us);
+
+            /// Retry the BMP280 bring-up from the reset, or fail if out of attempts
+            /// \param reason The reason for the retry
+            /// \param now_us The current time in microseconds
+            void retry_bmp280_bringup(const char* reason, int64_t now_us);
+
+            // Bring-up timeouts and the number of attempts before giving up
+            static constexpr int64_t BMP280_SCAN_TIMEOUT_US = 100 * 1000;
+            static constexpr int64_t BMP280_RESET_TIMEOUT_US = 50 * 1000;
+            static constexpr int BMP280_MAX_ATTEMPTS = 3;
 
             smooth::core::io::i2c::Master i2c1_master;
             std::unique_ptr<smooth::application::sensor::DHT12> dht12{};
             std::unique_ptr<smooth::application::sensor::BME280> bmp280{};
             bool dht12_initialized{ false };
             bool bmp280_initialized{ false };
+            Bmp280State bmp280_state{ Bmp280State::Scan };
+            int64_t bmp280_state_start_us{ -1 };
+            int bmp280_attempts{ 0 };
+            Bmp280ProfileId bmp280_profile_id{ Bmp280ProfileId::UltraLowPowerForced };
             EnvirValue envir_value{};
     };
 }
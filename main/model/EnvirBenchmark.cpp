@@ -0,0 +1,256 @@
+/****************************************************************************************
+ * EnvirBenchmark.cpp - Measures the cost and accuracy of the EnvirValue derived values
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/EnvirBenchmark.h"
+#include <algorithm>
+#include <array>
+#include <math.h>
+#include <esp_timer.h>
+#include <smooth/core/logging/log.h>
+#include "model/EnvirValue.h"
+#include "model/Psychrometrics.h"
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "EnvirBenchmark";
+    static constexpr int ITERATIONS = 1024;
+    static constexpr int CPU_MHZ = 240;
+
+    // The results are summed into this so the calculations are not optimized away
+    static volatile float sink = 0;
+
+    // Measurements spanning the operating range, temperature C, humidity %RH, pressure hPa
+    struct Measurement
+    {
+        float temperature;
+        float humidity;
+        float pressure;
+    };
+
+    static const std::array<Measurement, 8> measurements{ {
+        { -5.0f, 80.0f, 1020.0f },
+        { 5.0f, 60.0f, 1005.0f },
+        { 15.0f, 45.0f, 990.0f },
+        { 21.5f, 35.0f, 925.0f },
+        { 26.0f, 70.0f, 930.0f },
+        { 31.0f, 55.0f, 915.0f },
+        { 35.0f, 10.0f, 900.0f },
+        { 40.0f, 90.0f, 1010.0f }
+    } };
+
+    // The dew point as the getter of EnvirValue calculated it on every call before the
+    // derived values were computed at publish time, the NOAA approximation in double precision
+    static double original_dew_point_celsius(double t, double rh)
+    {
+        double dry = 1 - (0.01 * rh);
+
+        return t - (14.55 + 0.114 * t) * dry - pow((2.5 + 0.007 * t) * dry, 3) - (15.9 + 0.117 * t) * pow(dry, 14);
+    }
+
+    // The accuracy references of the single precision Psychrometrics, the same formulas in
+    // double precision.  The heat index and the sea level pressure are also the formulas
+    // of the original getters, the dew point is the inverse of the Magnus formula instead
+    // of the NOAA approximation, and the absolute humidity and the vapor pressure deficit
+    // are new
+    static double reference_saturation_vapor_pressure_hPa(double t)
+    {
+        return 6.1094 * exp(17.625 * t / (243.04 + t));
+    }
+
+    static double reference_dew_point_celsius(double t, double rh)
+    {
+        double gamma = log((rh < 1.0 ? 1.0 : rh) / 100.0) + 17.625 * t / (243.04 + t);
+
+        return 243.04 * gamma / (17.625 - gamma);
+    }
+
+    static double reference_heat_index_fahrenheit(double t_c, double rh)
+    {
+        double t = ((t_c * 9) / 5) + 32;
+        double heat_index = 0.5 * (t + 61.0 + ((t - 68) * 1.2) + (rh * 0.094));
+
+        if (heat_index > 79)
+        {
+            heat_index = -42.379 + 2.04901523 * t + 10.14333127 * rh
+                         + -0.22475541 * t * rh
+                         + -0.00683783 * pow(t, 2)
+                         + -0.05481717 * pow(rh, 2)
+                         + 0.00122874 * pow(t, 2) * rh
+                         + 0.00085282 * t * pow(rh, 2)
+                         + -0.00000199 * pow(t, 2) * pow(rh, 2);
+
+            if (rh < 13 && t >= 80.0 && t <= 112.0)
+            {
+                heat_index -= ((13.0 - rh) * 0.25) * sqrt((17.0 - fabs(t - 95.0)) * 0.05882);
+            }
+
+            if (rh > 85.0 && t >= 80.0 && t <= 87.0)
+            {
+                heat_index += ((rh - 85.0) * 0.1) * ((87.0 - t) * 0.2);
+            }
+        }
+
+        return heat_index;
+    }
+
+    static double reference_sea_level_pressure_hPa(double p, double t, double altitude)
+    {
+        return p / pow(1 - ((0.0065 * altitude) / (t + (0.0065 * altitude) + 273.15)), 5.257);
+    }
+
+    static double reference_absolute_humidity_g_m3(double t, double rh)
+    {
+        return 216.7 * reference_saturation_vapor_pressure_hPa(t) * rh / 100.0 / (t + 273.15);
+    }
+
+    static double reference_vapor_pressure_deficit_kPa(double t, double rh)
+    {
+        return reference_saturation_vapor_pressure_hPa(t) * (1.0 - rh / 100.0) / 10.0;
+    }
+
+    // Time a function over the iterations and the measurements
+    template<typename Function>
+    static int64_t time_per_event_ns(Function function)
+    {
+        int64_t start_us = esp_timer_get_time();
+
+        for (int i = 0; i < ITERATIONS; i++)
+        {
+            function(measurements[i % measurements.size()]);
+        }
+
+        return (esp_timer_get_time() - start_us) * 1000 / ITERATIONS;
+    }
+
+    // Log a result
+    static void log_result(const char* name, int64_t ns)
+    {
+        Log::info(TAG, "{}: {} ns = {} cycles per event", name, ns, ns * CPU_MHZ / 1000);
+    }
+
+    // Log the time of a calculation in single and double precision
+    template<typename Single, typename Double>
+    static void compare_timing(const char* name, Single single, Double reference)
+    {
+        int64_t single_ns = time_per_event_ns([&single](const Measurement& m) { sink = sink + single(m); });
+        int64_t double_ns = time_per_event_ns([&reference](const Measurement& m) {
+            sink = sink + static_cast<float>(reference(m));
+        });
+
+        Log::info(TAG, "{}: float {} ns = {} cycles, double {} ns = {} cycles",
+                  name, single_ns, single_ns * CPU_MHZ / 1000, double_ns, double_ns * CPU_MHZ / 1000);
+    }
+
+    // Log the maximum error of the single precision calculations against the reference
+    // over -20..60C, 1..100%RH and 300..1100hPa
+    static void log_accuracy()
+    {
+        double max_svp = 0, max_dew = 0, max_heat = 0, max_sea = 0, max_abs = 0, max_vpd = 0;
+
+        for (float t = -20.0f; t <= 60.0f; t += 0.5f)
+        {
+            double svp = Psychrometrics::saturation_vapor_pressure_hPa(t) - reference_saturation_vapor_pressure_hPa(t);
+            max_svp = std::max(max_svp, fabs(svp));
+
+            for (float rh = 1.0f; rh <= 100.0f; rh += 1.5f)
+            {
+                double dew = Psychrometrics::dew_point_celsius(t, rh) - reference_dew_point_celsius(t, rh);
+                double heat = Psychrometrics::heat_index_fahrenheit(t, rh) - reference_heat_index_fahrenheit(t, rh);
+                double abs = Psychrometrics::absolute_humidity_g_m3(t, rh) - reference_absolute_humidity_g_m3(t, rh);
+                double vpd = Psychrometrics::vapor_pressure_deficit_kPa(t, rh) - reference_vapor_pressure_deficit_kPa(t, rh);
+                max_dew = std::max(max_dew, fabs(dew));
+                max_heat = std::max(max_heat, fabs(heat));
+                max_abs = std::max(max_abs, fabs(abs));
+                max_vpd = std::max(max_vpd, fabs(vpd));
+            }
+
+            for (float p = 300.0f; p <= 1100.0f; p += 10.0f)
+            {
+                double sea = Psychrometrics::sea_level_pressure_hPa(p, t, EnvirValue::ALTITUDE)
+                             - reference_sea_level_pressure_hPa(p, t, EnvirValue::ALTITUDE);
+                max_sea = std::max(max_sea, fabs(sea));
+            }
+        }
+
+        Log::info(TAG, "max error: saturation vapor pressure {:.6f} hPa, dew point {:.6f} C, heat index {:.6f} F",
+                  max_svp, max_dew, max_heat);
+        Log::info(TAG, "max error: sea level pressure {:.6f} hPa, absolute humidity {:.6f} g/m3, vpd {:.6f} kPa",
+                  max_sea, max_abs, max_vpd);
+    }
+
+    // Run the benchmarks
+    void EnvirBenchmark::run()
+    {
+        EnvirValue value{};
+
+        // The derived values calculated in double precision by the original getters, as
+        // CPHumidity and CPBmp280 called them on every event
+        int64_t per_subscriber_ns = time_per_event_ns([](const Measurement& m) {
+            double heat_index = reference_heat_index_fahrenheit(m.temperature, m.humidity);
+            double dew_point = original_dew_point_celsius(m.temperature, m.humidity) * 1.8 + 32;
+            double sea_level = reference_sea_level_pressure_hPa(m.pressure, m.temperature, EnvirValue::ALTITUDE);
+            sink = sink + static_cast<float>(heat_index + dew_point + sea_level / 3386.389);
+        });
+
+        // The derived values calculated once by EnvHat when publishing
+        int64_t at_publish_ns = time_per_event_ns([&value](const Measurement& m) {
+            value.set_temperture_degree_C(m.temperature);
+            value.set_relative_humidity(m.humidity);
+            value.set_pressure_hPa(m.pressure);
+            value.set_bmp280_temperture_degree_C(m.temperature);
+            value.compute_derived_values();
+            sink = sink + value.get_heat_index_fahrenheit();
+        });
+
+        // The loads left to the subscribers
+        int64_t subscriber_loads_ns = time_per_event_ns([&value](const Measurement& /*m*/) {
+            sink = sink + value.get_heat_index_fahrenheit() + value.get_dew_point_fahrenheit()
+                   + value.get_sea_level_pressure_inHg();
+        });
+
+        log_result("derived values per subscriber", per_subscriber_ns);
+        log_result("derived values at publish", at_publish_ns);
+        log_result("derived values subscriber loads", subscriber_loads_ns);
+
+        compare_timing("saturation vapor pressure",
+                       [](const Measurement& m) { return Psychrometrics::saturation_vapor_pressure_hPa(m.temperature); },
+                       [](const Measurement& m) { return reference_saturation_vapor_pressure_hPa(m.temperature); });
+        compare_timing("dew point",
+                       [](const Measurement& m) { return Psychrometrics::dew_point_celsius(m.temperature, m.humidity); },
+                       [](const Measurement& m) { return reference_dew_point_celsius(m.temperature, m.humidity); });
+        compare_timing("heat index",
+                       [](const Measurement& m) { return Psychrometrics::heat_index_fahrenheit(m.temperature, m.humidity); },
+                       [](const Measurement& m) { return reference_heat_index_fahrenheit(m.temperature, m.humidity); });
+        compare_timing("sea level pressure",
+                       [](const Measurement& m) {
+                           return Psychrometrics::sea_level_pressure_hPa(m.pressure, m.temperature, EnvirValue::ALTITUDE);
+                       },
+                       [](const Measurement& m) {
+                           return reference_sea_level_pressure_hPa(m.pressure, m.temperature, EnvirValue::ALTITUDE);
+                       });
+        compare_timing("absolute humidity",
+                       [](const Measurement& m) { return Psychrometrics::absolute_humidity_g_m3(m.temperature, m.humidity); },
+                       [](const Measurement& m) { return reference_absolute_humidity_g_m3(m.temperature, m.humidity); });
+        compare_timing("vapor pressure deficit",
+                       [](const Measurement& m) { return Psychrometrics::vapor_pressure_deficit_kPa(m.temperature, m.humidity); },
+                       [](const Measurement& m) { return reference_vapor_pressure_deficit_kPa(m.temperature, m.humidity); });
+
+        log_accuracy();
+    }
+}
@@ -0,0 +1,42 @@
+/****************************************************************************************
+ * EnvirBenchmark.h - Measures the cost and accuracy of the EnvirValue derived values
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The benchmarks are run on the device by a SensorRequest and on the host with --bench.
+//  Each is timed with esp_timer over a set of measurements spanning the operating range
+//  and reported in nanoseconds and in CPU cycles at the 240MHz clock of sdkconfig.
+//
+//  "per subscriber" is the work CPHumidity and CPBmp280 did on every event when the
+//  derived values were computed by the getters in double precision; "at publish" is the
+//  work done once by EnvHat and "subscriber loads" the work left to the subscribers.
+//
+//  Each Psychrometrics calculation is timed against the same formula in double
+//  precision and its maximum error against it is logged, the bounds documented in
+//  Psychrometrics.h come from these.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace redstone
+{
+    class EnvirBenchmark
+    {
+        public:
+            /// Run the benchmarks and the accuracy checks and log the results, takes about
+            /// a second on the device
+            static void run();
+    };
+}
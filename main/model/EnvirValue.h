@@ -17,13 +17,17 @@
 #pragma once
 
 #include <string>
-#include <math.h>
+#include <cstdint>
+#include "model/Psychrometrics.h"
 
 namespace redstone
 {
     class EnvirValue
     {
         public:
+            /// The altitude of my current location in meters, for the sea level pressure
+            static constexpr float ALTITUDE = 802.0f;
+
             EnvirValue() {}
 
             /// Get the temperature in degree fahrenheit
@@ -54,6 +58,13 @@ namespace redstone
                 bmp280_temp = value;
             }
 
+            /// Get BMP280 temperature in degree celsius
+            /// \param return Return the temperature in degree celsius
+            float get_bmp280_temperature_degree_C() const
+            {
+                return bmp280_temp;
+            }
+
             /// Get BMP280 temperature in degree fahrenheit
             /// \param return Return the temperature in degree farenheit
             float get_bmp280_temperture_degree_F() const
@@ -89,54 +100,24 @@ namespace redstone
                 pressure = value;
             }
 
-            /// Get the sea level pressure in hPa.
-            /// Note: 802 in equation is the altitude of my current location in meters
+            /// Get the sea level pressure in hPa, see compute_derived_values()
             /// \param return Return the sea level pressure in hPa
             float get_sea_level_pressure_hPa() const
             {
-                return pressure / pow(1 - ((0.0065 * 802) / (bmp280_temp + (0.0065 * 802) + 273.15)), 5.257);
+                return sea_level_pressure;
             }
 
             /// Get the sea level pressure in inHg
             /// \param return Return the sea level pressure in inHg
             float get_sea_level_pressure_inHg() const
             {
-                return get_sea_level_pressure_hPa() / 3386.389;
+                return sea_level_pressure / 3386.389f;
             }
 
-            /// Get the heat index fahrenheit
+            /// Get the heat index fahrenheit, see compute_derived_values()
             /// \param return Return the heat index in fahrenheit
             float get_heat_index_fahrenheit() const
             {
-                // Using both Rothfusz and Steadman's equations
-	            // http://www.wpc.ncep.noaa.gov/html/heatindex_equation.shtml
-
-                float heat_index;
-                float temp_deg_f = get_temperture_degree_F();
-
-                heat_index = 0.5 * (temp_deg_f + 61.0 +((temp_deg_f -68) * 1.2) + (humidity * 0.094));
-
-                if (heat_index > 79)
-                {
-                    heat_index = -42.379 + 2.04901523 * temp_deg_f + 10.14333127 * humidity
-				                 + -0.22475541 * temp_deg_f * humidity
-				                 + -0.00683783 * pow(temp_deg_f, 2)
-				                 + -0.05481717 * pow(humidity, 2)
-				                 + 0.00122874 * pow(temp_deg_f, 2) * humidity
-				                 + 0.00085282 * temp_deg_f * pow(humidity, 2)
-				                 + -0.00000199 * pow(temp_deg_f, 2) * pow(humidity, 2);
-
-                    if (humidity<13 && temp_deg_f>=80.0 && temp_deg_f<=112.0)
-                    {
-                        heat_index -= ((13.0 - humidity) * 0.25) * sqrt((17.0 - abs(temp_deg_f - 95.0)) * 0.05882);
-                    }
-
-                    if (humidity>85.0 && temp_deg_f>=80.0 && temp_deg_f<=87.0)
-                    {
-                        heat_index += ((humidity - 85.0) * 0.1) * ((87.0 - temp_deg_f) * 0.2);
-                    }
-                }
-
                 return heat_index;
             }
 
@@ -144,31 +125,74 @@ namespace redstone
             /// \param return Return the heat index in celsius
             float get_heat_index_celsius() const
             {
-                return (get_heat_index_fahrenheit() -32) * 0.55555;
+                return (heat_index - 32) * 0.55555f;
             }
 
-            /// Get the dew point value in celsius
+            /// Get the dew point value in celsius, see compute_derived_values()
             /// \return Retuen the dew point value in celsius
             float get_dew_point_celsius() const
             {
-                // dewPoint function NOAA
-                // reference (1) : http://wahiduddin.net/calc/density_algorithms.htm
-                // reference (2) : http://www.colorado.edu/geography/weather_station/Geog_site/about.htm
-                // Good approximation for 0 ... +70 °C with max. deviation less than 0.25 °C
-
-                float dew_point = temperature - (14.55 + 0.114 * temperature) * (1 - (0.01 * humidity)) 
-                                  - pow(((2.5 + 0.007 * temperature) * (1 - (0.01 * humidity))),3) 
-                                  - (15.9 + 0.117 * temperature) * pow((1 - (0.01 * humidity)), 14);
-
                 return dew_point;
             }
 
-            
             /// Get the dew point value in fahrenheit
             /// \return Retuen the dew point value in fahrenheit
             float get_dew_point_fahrenheit() const
             {
-                return get_dew_point_celsius() * 1.8 + 32;
+                return dew_point * 1.8f + 32;
+            }
+
+            /// Get the absolute humidity, see compute_derived_values()
+            /// \param return Return the absolute humidity in g/m3
+            float get_absolute_humidity() const
+            {
+                return absolute_humidity;
+            }
+
+            /// Get the vapor pressure deficit, see compute_derived_values()
+            /// \param return Return the vapor pressure deficit in kPa
+            float get_vapor_pressure_deficit_kPa() const
+            {
+                return vapor_pressure_deficit;
+            }
+
+            /// Compute the derived values from the measurements, in single precision.
+            /// Called once by the publisher so the subscribers only load the results.
+            void compute_derived_values()
+            {
+                sea_level_pressure = Psychrometrics::sea_level_pressure_hPa(pressure, bmp280_temp, ALTITUDE);
+                heat_index = Psychrometrics::heat_index_fahrenheit(temperature, humidity);
+                dew_point = Psychrometrics::dew_point_celsius(temperature, humidity);
+                absolute_humidity = Psychrometrics::absolute_humidity_g_m3(temperature, humidity);
+                vapor_pressure_deficit = Psychrometrics::vapor_pressure_deficit_kPa(temperature, humidity);
+            }
+
+            /// Set the time the value was published
+            /// \param value The time in microseconds since boot
+            void set_timestamp_us(int64_t value)
+            {
+                timestamp_us = value;
+            }
+
+            /// Get the time the value was published
+            /// \param return Return the time in microseconds since boot
+            int64_t get_timestamp_us() const
+            {
+                return timestamp_us;
+            }
+
+            /// Set the sequence number, incremented each time a value is published
+            /// \param value The sequence number
+            void set_sequence(uint32_t value)
+            {
+                sequence = value;
+            }
+
+            /// Get the sequence number
+            /// \param return Return the sequence number
+            uint32_t get_sequence() const
+            {
+                return sequence;
             }
 
         private:
@@ -176,5 +200,12 @@ namespace redstone
             float humidity;
             float pressure;
             float bmp280_temp;
+            float sea_level_pressure{ 0 };
+            float heat_index{ 0 };
+            float dew_point{ 0 };
+            float absolute_humidity{ 0 };
+            float vapor_pressure_deficit{ 0 };
+            int64_t timestamp_us{ 0 };
+            uint32_t sequence{ 0 };
     };
 }
@@ -0,0 +1,252 @@
+/****************************************************************************************
+ * FatSampleStore.cpp - Stores the sample log in two files on the app_storage FAT partition
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/FatSampleStore.h"
+#include <algorithm>
+#include <vector>
+#include <unistd.h>
+#include <esp_timer.h>
+#include <esp_vfs_fat.h>
+#include <smooth/core/logging/log.h>
+#include "model/SampleLog.h"
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "FatSampleStore";
+    static const char* PARTITION_LABEL = "app_storage";
+
+    // Constructor
+    FatSampleStore::FatSampleStore(const char* file_prefix, size_t max_file_blocks) :
+            file_prefix(file_prefix),
+            max_file_blocks(max_file_blocks)
+    {
+    }
+
+    // Destructor
+    FatSampleStore::~FatSampleStore()
+    {
+        if (file != nullptr)
+        {
+            fclose(file);
+        }
+    }
+
+    // Mount the partition, once for all stores
+    bool FatSampleStore::mount()
+    {
+        static bool mounted = false;
+
+        if (!mounted)
+        {
+            // Each store holds a file open and reads the other one
+            esp_vfs_fat_mount_config_t mount_config{};
+            mount_config.format_if_mount_failed = true;
+            mount_config.max_files = 4;
+            mount_config.allocation_unit_size = SampleLogBlock::BLOCK_SIZE;
+            wl_handle_t wl_handle;
+
+            mounted = esp_vfs_fat_spiflash_mount(STORAGE_BASE_PATH, PARTITION_LABEL, &mount_config, &wl_handle) == ESP_OK;
+
+            if (!mounted)
+            {
+                Log::error(TAG, "Mounting the {} partition failed", PARTITION_LABEL);
+            }
+        }
+
+        return mounted;
+    }
+
+    // Mount the partition and find where to append
+    bool FatSampleStore::initialize()
+    {
+        bool res = mount();
+
+        if (res)
+        {
+            // Append to the file holding the newest block, the highest sequence number
+            int64_t start_us = esp_timer_get_time();
+            uint32_t file_last_sequence[FILE_COUNT]{};
+            last_boot = 0;
+
+            for (int index = 0; index < FILE_COUNT; index++)
+            {
+                scan_file(index, file_last_sequence[index]);
+            }
+
+            current_file = file_last_sequence[1] > file_last_sequence[0] ? 1 : 0;
+            last_sequence = std::max(file_last_sequence[0], file_last_sequence[1]);
+            scan_us = esp_timer_get_time() - start_us;
+
+            res = open_file(current_file);
+        }
+
+        return res;
+    }
+
+    // Remove both files and start again
+    bool FatSampleStore::clear()
+    {
+        if (file != nullptr)
+        {
+            fclose(file);
+            file = nullptr;
+        }
+
+        for (int index = 0; index < FILE_COUNT; index++)
+        {
+            remove(get_file_path(index).c_str());
+            blocks[index] = 0;
+        }
+
+        current_file = 0;
+        last_sequence = 0;
+        last_boot = 0;
+
+        return open_file(current_file);
+    }
+
+    // Append a block, rotating to the other file when this one is full
+    bool FatSampleStore::append(const uint8_t* data)
+    {
+        if (file != nullptr && blocks[current_file] >= max_file_blocks)
+        {
+            fclose(file);
+            current_file = (current_file + 1) % FILE_COUNT;
+            blocks[current_file] = 0;
+            open_file(current_file);
+        }
+
+        bool res = file != nullptr
+                   && fwrite(data, 1, SampleLogBlock::BLOCK_SIZE, file) == SampleLogBlock::BLOCK_SIZE
+                   && fflush(file) == 0
+                   && fsync(fileno(file)) == 0;
+
+        if (res)
+        {
+            blocks[current_file] += 1;
+            last_sequence = SampleLogBlock::get_sequence(data);
+            last_boot = std::max(last_boot, SampleLogBlock::get_boot(data));
+        }
+        else if (file != nullptr)
+        {
+            // The next append overwrites the partly written block
+            fseek(file, static_cast<long>(blocks[current_file] * SampleLogBlock::BLOCK_SIZE), SEEK_SET);
+        }
+
+        return res;
+    }
+
+    // Get a valid block, the blocks of the other file are the older ones
+    const uint8_t* FatSampleStore::get_block(size_t index, uint8_t* buffer)
+    {
+        int older_file = (current_file + 1) % FILE_COUNT;
+        bool res = index < blocks[older_file]
+                   ? read_block(older_file, index, buffer)
+                   : read_block(current_file, index - blocks[older_file], buffer);
+
+        return res ? buffer : nullptr;
+    }
+
+    // Read a block of a log file
+    bool FatSampleStore::read_block(int index, size_t block, uint8_t* buffer)
+    {
+        bool res = false;
+        long offset = static_cast<long>(block * SampleLogBlock::BLOCK_SIZE);
+
+        if (block >= blocks[index])
+        {
+            res = false;
+        }
+        else if (index == current_file)
+        {
+            // The file being appended is read through its handle, then positioned for the next append
+            res = fseek(file, offset, SEEK_SET) == 0
+                  && fread(buffer, 1, SampleLogBlock::BLOCK_SIZE, file) == SampleLogBlock::BLOCK_SIZE;
+            fseek(file, static_cast<long>(blocks[current_file] * SampleLogBlock::BLOCK_SIZE), SEEK_SET);
+        }
+        else
+        {
+            FILE* f = fopen(get_file_path(index).c_str(), "rb");
+
+            if (f != nullptr)
+            {
+                res = fseek(f, offset, SEEK_SET) == 0
+                      && fread(buffer, 1, SampleLogBlock::BLOCK_SIZE, f) == SampleLogBlock::BLOCK_SIZE;
+                fclose(f);
+            }
+        }
+
+        return res;
+    }
+
+    // Get the path of a log file
+    std::string FatSampleStore::get_file_path(int index) const
+    {
+        return std::string(STORAGE_BASE_PATH) + "/" + file_prefix + std::to_string(index) + ".bin";
+    }
+
+    // Read the valid blocks of a log file, the first invalid block ends the file
+    void FatSampleStore::scan_file(int index, uint32_t& file_last_sequence)
+    {
+        FILE* f = fopen(get_file_path(index).c_str(), "rb");
+        blocks[index] = 0;
+        file_last_sequence = 0;
+
+        if (f != nullptr)
+        {
+            // On the heap, the task stack can't hold a block
+            std::vector<uint8_t> data(SampleLogBlock::BLOCK_SIZE);
+
+            while (blocks[index] < max_file_blocks
+                   && fread(data.data(), 1, data.size(), f) == data.size()
+                   && SampleLogBlock::is_valid(data.data()))
+            {
+                blocks[index] += 1;
+                file_last_sequence = SampleLogBlock::get_sequence(data.data());
+                last_boot = std::max(last_boot, SampleLogBlock::get_boot(data.data()));
+            }
+
+            fclose(f);
+        }
+    }
+
+    // Open a log file for appending after its valid blocks
+    bool FatSampleStore::open_file(int index)
+    {
+        std::string path = get_file_path(index);
+
+        // A torn block after the valid blocks is overwritten
+        file = blocks[index] > 0 ? fopen(path.c_str(), "r+b") : fopen(path.c_str(), "w+b");
+
+        if (file != nullptr
+            && fseek(file, static_cast<long>(blocks[index] * SampleLogBlock::BLOCK_SIZE), SEEK_SET) != 0)
+        {
+            fclose(file);
+            file = nullptr;
+        }
+
+        if (file == nullptr)
+        {
+            Log::error(TAG, "Opening {} failed", path);
+            blocks[index] = 0;
+        }
+
+        return file != nullptr;
+    }
+}
@@ -0,0 +1,114 @@
+/****************************************************************************************
+ * FatSampleStore.h - Stores the sample log in two files on the app_storage FAT partition
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The app_storage partition is mounted as FAT with wear levelling and the blocks are
+//  appended to two files used in turn; when the one being appended reaches
+//  max_file_blocks the other is truncated and appended from then on, so at least
+//  max_file_blocks blocks of history are kept.  At boot both files are scanned: the file
+//  holding the highest sequence number is appended to, after its last valid block, so a
+//  block torn by a power loss is overwritten.
+//
+//  Every block read is copied out of the file by the FAT and wear levelling layers.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include "model/ISampleStore.h"
+
+// The mount point of the app_storage partition, the host build uses a local directory
+#ifndef STORAGE_BASE_PATH
+#define STORAGE_BASE_PATH "/storage"
+#endif
+
+namespace redstone
+{
+    class FatSampleStore : public ISampleStore
+    {
+        public:
+            /// Constructor
+            /// \param file_prefix The start of the file names, "<prefix>0.bin" and "<prefix>1.bin"
+            /// \param max_file_blocks The blocks per file
+            FatSampleStore(const char* file_prefix, size_t max_file_blocks);
+
+            /// Destructor
+            ~FatSampleStore() override;
+
+            /// Mount the partition, once for all stores
+            /// \return true if the partition is mounted
+            static bool mount();
+
+            bool initialize() override;
+
+            bool clear() override;
+
+            bool append(const uint8_t* data) override;
+
+            size_t get_block_count() const override
+            {
+                return blocks[0] + blocks[1];
+            }
+
+            const uint8_t* get_block(size_t index, uint8_t* buffer) override;
+
+            uint32_t get_last_sequence() const override
+            {
+                return last_sequence;
+            }
+
+            uint16_t get_last_boot() const override
+            {
+                return last_boot;
+            }
+
+            int64_t get_scan_us() const override
+            {
+                return scan_us;
+            }
+
+            const char* get_name() const override
+            {
+                return "FAT";
+            }
+
+        private:
+            static constexpr int FILE_COUNT = 2;
+
+            /// Get the path of a log file
+            std::string get_file_path(int index) const;
+
+            /// Read the valid blocks of a log file
+            /// \param index The file
+            void scan_file(int index, uint32_t& file_last_sequence);
+
+            /// Open a log file for appending after its valid blocks, 0 blocks truncates the file
+            bool open_file(int index);
+
+            /// Read a block of a log file
+            bool read_block(int index, size_t block, uint8_t* buffer);
+
+            std::string file_prefix;
+            size_t max_file_blocks;
+            FILE* file{ nullptr };
+            int current_file{ 0 };
+            size_t blocks[FILE_COUNT]{};
+            uint32_t last_sequence{ 0 };
+            uint16_t last_boot{ 0 };
+            int64_t scan_us{ 0 };
+    };
+}
@@ -0,0 +1,116 @@
+/****************************************************************************************
+ * Histogram.h - A histogram of unsigned values with power of two buckets
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Bucket 0 counts the zeros and bucket n the values of n bits, 2^(n-1) to 2^n - 1, so
+//  a value is added with a count of its leading zeros and the histogram is 152 bytes
+//  whatever the range.  The minimum, maximum and mean are exact, a percentile is the
+//  upper bound of the bucket it falls in.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace redstone
+{
+    class Histogram
+    {
+        public:
+            static constexpr int BUCKETS = 33;
+
+            /// Add a value
+            /// \param value The value
+            void add(uint32_t value)
+            {
+                int bucket = value == 0 ? 0 : 32 - __builtin_clz(value);
+                buckets[bucket] += 1;
+                min = count == 0 || value < min ? value : min;
+                max = value > max ? value : max;
+                sum += value;
+                count += 1;
+            }
+
+            /// Remove all values
+            void clear()
+            {
+                *this = Histogram{};
+            }
+
+            /// Get the number of values
+            uint32_t get_count() const
+            {
+                return count;
+            }
+
+            /// Get the lowest value, 0 if there are none
+            uint32_t get_min() const
+            {
+                return min;
+            }
+
+            /// Get the highest value, 0 if there are none
+            uint32_t get_max() const
+            {
+                return max;
+            }
+
+            /// Get the mean of the values, 0 if there are none
+            uint32_t get_mean() const
+            {
+                return count > 0 ? static_cast<uint32_t>(sum / count) : 0;
+            }
+
+            /// Get the number of values in a bucket
+            /// \param bucket The bucket, the values of that many bits
+            uint32_t get_bucket(int bucket) const
+            {
+                return buckets[bucket];
+            }
+
+            /// Get an upper bound of a percentile
+            /// \param percent The percentile, 0 to 100
+            /// \param return Return the upper bound of the bucket the percentile falls in,
+            /// never more than the maximum
+            uint32_t get_percentile(uint32_t percent) const
+            {
+                uint64_t rank = (static_cast<uint64_t>(count) * percent + 99) / 100;
+                uint64_t seen = 0;
+                uint32_t bound = max;
+
+                for (int bucket = 0; bucket < BUCKETS && count > 0; bucket++)
+                {
+                    seen += buckets[bucket];
+
+                    if (seen >= rank && buckets[bucket] > 0)
+                    {
+                        bound = bucket == 0 ? 0 : static_cast<uint32_t>((uint64_t{ 1 } << bucket) - 1);
+                        break;
+                    }
+                }
+
+                return bound < max ? bound : max;
+            }
+
+        private:
+            std::array<uint32_t, BUCKETS> buckets{};
+            uint32_t count{ 0 };
+            uint32_t min{ 0 };
+            uint32_t max{ 0 };
+            uint64_t sum{ 0 };
+    };
+}
@@ -0,0 +1,460 @@
+/****************************************************************************************
+ * HistoryQuery.cpp - Range queries over the sensor history with downsampling
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/HistoryQuery.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include "model/SampleLogger.h"
+
+namespace redstone
+{
+    // Class constants
+    static constexpr uint32_t SECONDS_PER_MINUTE = 60;
+    static constexpr uint32_t SECONDS_PER_HOUR = 3600;
+
+    // The period of the rows of each source, indexed by HistorySource
+    static const uint32_t source_periods_s[] = {
+        1,
+        static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(SampleLogger::SAMPLING.period).count()),
+        SECONDS_PER_MINUTE,
+        SECONDS_PER_HOUR
+    };
+
+    // Get the name of a history source
+    const char* get_history_source_name(HistorySource source)
+    {
+        static const char* names[] = { "raw", "sample log", "minute", "hour" };
+
+        return static_cast<size_t>(source) < 4 ? names[static_cast<size_t>(source)] : "unknown";
+    }
+
+    // Get the time bucket of a row
+    static size_t get_bucket(uint32_t time_s, uint32_t from_s, uint64_t span_s, size_t buckets)
+    {
+        auto bucket = static_cast<size_t>(static_cast<uint64_t>(time_s - from_s) * buckets / span_s);
+
+        return std::min(bucket, buckets - 1);
+    }
+
+    // Start a bucket
+    void LttbDownsampler::Bucket::clear(size_t bucket_index)
+    {
+        size = 0;
+        stride = 1;
+        index = bucket_index;
+        count = 0;
+        sum_time_s = 0;
+        sum_value = 0.0f;
+    }
+
+    // Add a row to a bucket, halving the candidates when they are full
+    void LttbDownsampler::Bucket::add(const SeriesSample& sample, uint32_t from_s)
+    {
+        if (count % stride == 0 && size == MAX_BUCKET_CANDIDATES)
+        {
+            for (size_t i = 0; i < MAX_BUCKET_CANDIDATES / 2; i++)
+            {
+                candidates[i] = candidates[i * 2];
+            }
+
+            size = MAX_BUCKET_CANDIDATES / 2;
+            stride *= 2;
+        }
+
+        if (count % stride == 0)
+        {
+            candidates[size++] = sample;
+        }
+
+        count += 1;
+        sum_time_s += sample.time_s - from_s;
+        sum_value += sample.value;
+    }
+
+    // Start a query
+    void LttbDownsampler::start(uint32_t from_s, uint32_t to_s, size_t points, const HistorySink* sink)
+    {
+        this->sink = sink;
+        this->from_s = from_s;
+        span_s = static_cast<uint64_t>(to_s) - from_s + 1;
+        this->points = points;
+
+        // The first and the last row are selected besides one row of each bucket
+        buckets = std::max(points, static_cast<size_t>(3)) - 2;
+        selected = 0;
+        has_first = false;
+        has_last = false;
+        current.clear(0);
+        next.clear(0);
+    }
+
+    // Add a row, selecting from the bucket before when a later bucket starts
+    void LttbDownsampler::add(const SeriesSample& sample)
+    {
+        if (!has_first)
+        {
+            has_first = true;
+
+            if (points > 0)
+            {
+                emit(sample);
+            }
+
+            return;
+        }
+
+        last = sample;
+        has_last = true;
+
+        // with less than 3 points there are no buckets, only the first and the last row
+        if (points < 3)
+        {
+            return;
+        }
+
+        size_t index = get_bucket(sample.time_s, from_s, span_s, buckets);
+
+        if (next.count > 0 && index != next.index)
+        {
+            if (current.count > 0)
+            {
+                select(current, static_cast<float>(next.sum_time_s) / next.count, next.sum_value / next.count,
+                       UINT32_MAX);
+            }
+
+            std::swap(current, next);
+            next.clear(index);
+        }
+        else if (next.count == 0)
+        {
+            next.clear(index);
+        }
+
+        next.add(sample, from_s);
+    }
+
+    // Select from the last two buckets and the last row
+    size_t LttbDownsampler::finish()
+    {
+        if (points < 3)
+        {
+            if (points == 2 && has_last)
+            {
+                emit(last);
+            }
+
+            return selected;
+        }
+
+        if (current.count > 0)
+        {
+            select(current, static_cast<float>(next.sum_time_s) / next.count, next.sum_value / next.count,
+                   UINT32_MAX);
+        }
+
+        if (next.count > 0)
+        {
+            select(next, static_cast<float>(last.time_s - from_s), last.value, last.time_s);
+            emit(last);
+        }
+
+        return selected;
+    }
+
+    // Select the candidate, before a time, making the largest triangle with the previous point and next
+    void LttbDownsampler::select(const Bucket& bucket, float next_time, float next_value, uint32_t before_s)
+    {
+        auto previous_time = static_cast<float>(previous.time_s - from_s);
+        float largest = -1.0f;
+        size_t chosen = 0;
+
+        for (size_t i = 0; i < bucket.size; i++)
+        {
+            const SeriesSample& candidate = bucket.candidates[i];
+
+            if (candidate.time_s < before_s)
+            {
+                auto time = static_cast<float>(candidate.time_s - from_s);
+                float area = std::fabs((previous_time - next_time) * (candidate.value - previous.value)
+                                       - (previous_time - time) * (next_value - previous.value));
+
+                if (area > largest)
+                {
+                    largest = area;
+                    chosen = i;
+                }
+            }
+        }
+
+        if (largest >= 0.0f)
+        {
+            emit(bucket.candidates[chosen]);
+        }
+    }
+
+    // Send a point to the sink
+    void LttbDownsampler::emit(const SeriesSample& sample)
+    {
+        (*sink)(sample);
+        previous = sample;
+        selected += 1;
+    }
+
+    // Start a query
+    void MinMaxDownsampler::start(uint32_t from_s, uint32_t to_s, size_t points, const HistorySink* sink)
+    {
+        this->sink = sink;
+        this->from_s = from_s;
+        span_s = static_cast<uint64_t>(to_s) - from_s + 1;
+        buckets = points / 2;
+        selected = 0;
+        index = 0;
+        has_rows = false;
+    }
+
+    // Add a row, sending the bucket before when a later bucket starts
+    void MinMaxDownsampler::add(const SeriesSample& sample)
+    {
+        // a bucket sends two points, with less than 2 nothing is selected
+        if (buckets == 0)
+        {
+            return;
+        }
+
+        size_t bucket = get_bucket(sample.time_s, from_s, span_s, buckets);
+
+        if (has_rows && bucket != index)
+        {
+            emit_bucket();
+            has_rows = false;
+        }
+
+        if (!has_rows)
+        {
+            has_rows = true;
+            index = bucket;
+            min = sample;
+            max = sample;
+        }
+        else
+        {
+            min = sample.value < min.value ? sample : min;
+            max = sample.value > max.value ? sample : max;
+        }
+    }
+
+    // Send the last bucket
+    size_t MinMaxDownsampler::finish()
+    {
+        if (has_rows)
+        {
+            emit_bucket();
+            has_rows = false;
+        }
+
+        return selected;
+    }
+
+    // Send the lowest and highest row of the bucket in time order, once if they are the same row
+    void MinMaxDownsampler::emit_bucket()
+    {
+        bool min_first = min.time_s <= max.time_s;
+        const SeriesSample& first = min_first ? min : max;
+        const SeriesSample& second = min_first ? max : min;
+
+        (*sink)(first);
+        selected += 1;
+
+        if (second.time_s != first.time_s || second.value != first.value)
+        {
+            (*sink)(second);
+            selected += 1;
+        }
+    }
+
+    // Constructor
+    HistoryQuery::HistoryQuery(const TimeSeriesStore& store, SampleLogger* sample_logger) :
+            store(store),
+            sample_logger(sample_logger)
+    {
+    }
+
+    // Choose the coarsest resolution with a row for every point that holds the start of the range
+    HistorySource HistoryQuery::choose_source(uint32_t from_s, uint32_t to_s, size_t points, Downsampling method) const
+    {
+        static const HistorySource coarsest_first[] = {
+            HistorySource::Hour, HistorySource::Minute, HistorySource::SampleLog, HistorySource::Raw
+        };
+
+        size_t buckets = method == Downsampling::Lttb
+                         ? std::max(points, static_cast<size_t>(3)) - 2
+                         : std::max(points / 2, static_cast<size_t>(1));
+        uint64_t bucket_s = std::max((static_cast<uint64_t>(to_s) - from_s + 1) / buckets, static_cast<uint64_t>(1));
+
+        HistorySource chosen = HistorySource::Raw;
+        uint32_t chosen_oldest_s = UINT32_MAX;
+        bool holds_start = false;
+
+        for (size_t i = 0; i < 4 && !holds_start; i++)
+        {
+            HistorySource candidate = coarsest_first[i];
+            uint32_t oldest_s;
+            uint32_t newest_s;
+
+            if (source_periods_s[static_cast<size_t>(candidate)] <= bucket_s
+                && get_span(candidate, oldest_s, newest_s)
+                && newest_s >= from_s
+                && oldest_s < chosen_oldest_s)
+            {
+                // Otherwise the one reaching back the furthest
+                chosen = candidate;
+                chosen_oldest_s = oldest_s;
+                holds_start = oldest_s <= from_s;
+            }
+        }
+
+        return chosen;
+    }
+
+    // Run a query
+    size_t HistoryQuery::run(SeriesField field, uint32_t from_s, uint32_t to_s, size_t points, Downsampling method,
+                             const HistorySink& sink)
+    {
+        size_t count = 0;
+        rows_read = 0;
+
+        if (points > 0 && from_s <= to_s)
+        {
+            source = choose_source(from_s, to_s, points, method);
+
+            if (method == Downsampling::Lttb)
+            {
+                lttb.start(from_s, to_s, points, &sink);
+                read_rows(source, field, from_s, to_s, method, [this](const SeriesSample& sample) {
+                              rows_read += 1;
+                              lttb.add(sample);
+                          });
+                count = lttb.finish();
+            }
+            else
+            {
+                min_max.start(from_s, to_s, points, &sink);
+                read_rows(source, field, from_s, to_s, method, [this](const SeriesSample& sample) {
+                              rows_read += 1;
+                              min_max.add(sample);
+                          });
+                count = min_max.finish();
+            }
+        }
+
+        return count;
+    }
+
+    // Get the time span held by a source
+    bool HistoryQuery::get_span(HistorySource history_source, uint32_t& oldest_s, uint32_t& newest_s) const
+    {
+        bool res = false;
+
+        if (history_source == HistorySource::SampleLog)
+        {
+            res = sample_logger != nullptr && sample_logger->get_span(oldest_s, newest_s);
+        }
+        else
+        {
+            SeriesResolution resolution = history_source == HistorySource::Raw ? SeriesResolution::Raw
+                                          : history_source == HistorySource::Minute ? SeriesResolution::Minute
+                                          : SeriesResolution::Hour;
+            res = store.get_span(resolution, oldest_s, newest_s);
+        }
+
+        return res;
+    }
+
+    // Read the rows of a source in a time range, oldest first
+    void HistoryQuery::read_rows(HistorySource history_source, SeriesField field, uint32_t from_s, uint32_t to_s,
+                                 Downsampling method, const HistorySink& add)
+    {
+        uint32_t oldest_s;
+        uint32_t newest_s;
+
+        if (!get_span(history_source, oldest_s, newest_s))
+        {
+            return;
+        }
+
+        uint32_t start_s = std::max(from_s, oldest_s);
+        uint32_t end_s = std::min(to_s, newest_s);
+
+        if (history_source == HistorySource::SampleLog)
+        {
+            auto f = static_cast<size_t>(field);
+
+            sample_logger->for_each_record(start_s, end_s, [f, &add](const SampleRecord& record) {
+                                               if (!std::isnan(record.values[f]))
+                                               {
+                                                   add(SeriesSample{ record.time_s, record.values[f] });
+                                               }
+                                           });
+            return;
+        }
+
+        // A window of CHUNK_SIZE periods holds at most CHUNK_SIZE rows, the rows have distinct periods
+        uint64_t window_s = static_cast<uint64_t>(CHUNK_SIZE) * source_periods_s[static_cast<size_t>(history_source)];
+
+        for (uint64_t cursor_s = start_s; cursor_s <= end_s; cursor_s += window_s)
+        {
+            auto window_end_s = static_cast<uint32_t>(std::min(cursor_s + window_s - 1, static_cast<uint64_t>(end_s)));
+
+            if (history_source == HistorySource::Raw)
+            {
+                size_t count = store.read_raw(field, static_cast<uint32_t>(cursor_s), window_end_s,
+                                              samples.data(), CHUNK_SIZE);
+
+                for (size_t i = 0; i < count; i++)
+                {
+                    if (!std::isnan(samples[i].value))
+                    {
+                        add(samples[i]);
+                    }
+                }
+            }
+            else
+            {
+                SeriesResolution resolution = history_source == HistorySource::Minute
+                                              ? SeriesResolution::Minute : SeriesResolution::Hour;
+                size_t count = store.read_rollups(resolution, field, static_cast<uint32_t>(cursor_s), window_end_s,
+                                                  rollups.data(), CHUNK_SIZE);
+
+                for (size_t i = 0; i < count; i++)
+                {
+                    const SeriesRollup& rollup = rollups[i];
+
+                    if (rollup.count > 0 && method == Downsampling::Lttb)
+                    {
+                        add(SeriesSample{ rollup.time_s, rollup.mean });
+                    }
+                    else if (rollup.count > 0)
+                    {
+                        add(SeriesSample{ rollup.time_s, rollup.min });
+                        add(SeriesSample{ rollup.time_s, rollup.max });
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,230 @@
+/****************************************************************************************
+ * HistoryQuery.h - Range queries over the sensor history with downsampling
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  A query asks for one field over a time range as a number of points, for example the
+//  pressure of the last 24 hours as 160 points.  The history is held at four resolutions:
+//
+//      Raw         1 second, 5 minutes         TimeSeriesStore
+//      SampleLog   10 seconds, days            SampleLogger, on the SensorTask only
+//      Minute      1 minute, 2 hours           TimeSeriesStore rollups
+//      Hour        1 hour, 2 days              TimeSeriesStore rollups
+//
+//  The coarsest resolution with at least one row per point that holds the start of the
+//  range is read, or if none holds it the one reaching back the furthest.  The rows are
+//  reduced to the points by one of:
+//      Lttb        largest triangle three buckets, the row of each time bucket that
+//                  keeps the shape of the curve, from the rollup means
+//      MinMax      the lowest and the highest row of each time bucket, so no peak is
+//                  lost, from the rollup minimums and maximums
+//  A query sends at most the points asked for: Lttb sends the first and the last row
+//  when asked for less than 3, MinMax sends nothing when asked for less than 2 and at
+//  most an even number of points.
+//
+//  The points are streamed to a sink as they are selected.  The rows are read in chunks
+//  and the downsamplers hold at most two buckets, so a query uses about 1.7kB, all held
+//  by the HistoryQuery, whatever the range.  A bucket of more than MAX_BUCKET_CANDIDATES
+//  rows keeps every second, fourth... row as its Lttb candidates, its average is exact.
+//
+//  The newest minute and hour are still open and not in the rollups.  Rows without a
+//  value are skipped.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include "model/TimeSeriesStore.h"
+
+namespace redstone
+{
+    class SampleLogger;
+
+    /// The resolutions a query reads from
+    enum class HistorySource : uint8_t
+    {
+        Raw,
+        SampleLog,
+        Minute,
+        Hour
+    };
+
+    /// Get the name of a history source
+    /// \param source The source
+    /// \param return Return the name of the source
+    const char* get_history_source_name(HistorySource source);
+
+    /// The ways the rows are reduced to the points
+    enum class Downsampling : uint8_t
+    {
+        Lttb,
+        MinMax
+    };
+
+    using HistorySink = std::function<void(const SeriesSample&)>;
+
+    class LttbDownsampler
+    {
+        public:
+            /// The row candidates held for each bucket
+            static constexpr size_t MAX_BUCKET_CANDIDATES = 64;
+
+            /// Start a query
+            /// \param from_s The start of the time range
+            /// \param to_s The end of the time range, inclusive
+            /// \param points The most points selected, the first and the last row when less than 3
+            /// \param sink Called with each point selected
+            void start(uint32_t from_s, uint32_t to_s, size_t points, const HistorySink* sink);
+
+            /// Add a row, in time order
+            void add(const SeriesSample& sample);
+
+            /// Select the last points
+            /// \return The number of points selected
+            size_t finish();
+
+        private:
+            struct Bucket
+            {
+                std::array<SeriesSample, MAX_BUCKET_CANDIDATES> candidates;
+                size_t size;
+                size_t stride;          // every stride-th row is a candidate
+                size_t index;
+                size_t count;
+                uint64_t sum_time_s;    // relative to the start of the range
+                float sum_value;
+
+                void clear(size_t bucket_index);
+                void add(const SeriesSample& sample, uint32_t from_s);
+            };
+
+            /// Select the candidate of a bucket making the largest triangle with the
+            /// previous point and next
+            void select(const Bucket& bucket, float next_time, float next_value, uint32_t before_s);
+
+            /// Send a point to the sink
+            void emit(const SeriesSample& sample);
+
+            const HistorySink* sink{ nullptr };
+            uint32_t from_s{ 0 };
+            uint64_t span_s{ 1 };
+            size_t buckets{ 1 };
+            size_t points{ 3 };
+            size_t selected{ 0 };
+            bool has_first{ false };
+            bool has_last{ false };
+            SeriesSample previous{};
+            SeriesSample last{};
+            Bucket current{};
+            Bucket next{};
+    };
+
+    class MinMaxDownsampler
+    {
+        public:
+            /// Start a query
+            /// \param from_s The start of the time range
+            /// \param to_s The end of the time range, inclusive
+            /// \param points The most points selected, two for each bucket, none when less than 2
+            /// \param sink Called with each point selected
+            void start(uint32_t from_s, uint32_t to_s, size_t points, const HistorySink* sink);
+
+            /// Add a row, in time order
+            void add(const SeriesSample& sample);
+
+            /// Select the points of the last bucket
+            /// \return The number of points selected
+            size_t finish();
+
+        private:
+            /// Send the lowest and highest row of the bucket in time order
+            void emit_bucket();
+
+            const HistorySink* sink{ nullptr };
+            uint32_t from_s{ 0 };
+            uint64_t span_s{ 1 };
+            size_t buckets{ 1 };
+            size_t selected{ 0 };
+            size_t index{ 0 };
+            bool has_rows{ false };
+            SeriesSample min{};
+            SeriesSample max{};
+    };
+
+    class HistoryQuery
+    {
+        public:
+            /// Constructor
+            /// \param store The in-RAM history
+            /// \param sample_logger The sample log, only when the queries are run on the
+            /// SensorTask which owns it, nullptr otherwise
+            explicit HistoryQuery(const TimeSeriesStore& store, SampleLogger* sample_logger = nullptr);
+
+            /// Choose the source of a query
+            /// \param from_s The start of the time range in seconds since boot
+            /// \param to_s The end of the time range, inclusive
+            /// \param points The number of points asked for
+            /// \param method The downsampling
+            /// \param return Return the coarsest sufficient resolution
+            HistorySource choose_source(uint32_t from_s, uint32_t to_s, size_t points, Downsampling method) const;
+
+            /// Run a query
+            /// \param field The field
+            /// \param from_s The start of the time range in seconds since boot
+            /// \param to_s The end of the time range, inclusive
+            /// \param points The most points sent to sink, at least 2 for MinMax
+            /// \param method The downsampling
+            /// \param sink Called with each point, oldest first
+            /// \return The number of points sent
+            size_t run(SeriesField field, uint32_t from_s, uint32_t to_s, size_t points, Downsampling method,
+                       const HistorySink& sink);
+
+            /// Get the source of the last query
+            HistorySource get_source() const
+            {
+                return source;
+            }
+
+            /// Get the number of rows read by the last query
+            size_t get_rows_read() const
+            {
+                return rows_read;
+            }
+
+        private:
+            /// The rows read from a source in one go
+            static constexpr size_t CHUNK_SIZE = 16;
+
+            /// Get the time span held by a source
+            bool get_span(HistorySource history_source, uint32_t& oldest_s, uint32_t& newest_s) const;
+
+            /// Read the rows of a source in a time range, in chunks, oldest first
+            void read_rows(HistorySource history_source, SeriesField field, uint32_t from_s, uint32_t to_s,
+                           Downsampling method, const HistorySink& add);
+
+            const TimeSeriesStore& store;
+            SampleLogger* sample_logger;
+            HistorySource source{ HistorySource::Raw };
+            size_t rows_read{ 0 };
+
+            std::array<SeriesRollup, CHUNK_SIZE> rollups{};
+            std::array<SeriesSample, CHUNK_SIZE> samples{};
+            LttbDownsampler lttb{};
+            MinMaxDownsampler min_max{};
+    };
+}
@@ -0,0 +1,89 @@
+/****************************************************************************************
+ * I2cBusQueue.cpp - A queue of I2C transactions waiting to be performed on one I2C bus
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/I2cBusQueue.h"
+#include <algorithm>
+#include <esp_timer.h>
+#include <smooth/core/logging/log.h>
+#include "model/Timeline.h"
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "I2cBusQueue";
+
+    // Constructor
+    I2cBusQueue::I2cBusQueue(const char* bus_name, size_t capacity) : bus_name(bus_name), capacity(capacity)
+    {
+    }
+
+    // Add a transaction to the end of the queue
+    bool I2cBusQueue::enqueue(const char* name, Operation operation, Completion on_complete)
+    {
+        bool res = transactions.size() < capacity;
+
+        if (res)
+        {
+            transactions.push_back({ name, std::move(operation), std::move(on_complete) });
+        }
+        else
+        {
+            rejected_count += 1;
+            Log::warning(TAG, "{}: queue full, {} rejected", bus_name, name);
+        }
+
+        return res;
+    }
+
+    // Perform the transaction at the front of the queue
+    bool I2cBusQueue::process_next()
+    {
+        bool res = !transactions.empty();
+
+        if (res)
+        {
+            Transaction transaction = std::move(transactions.front());
+            transactions.pop_front();
+
+            Timeline::instance().begin(TimelineKind::Read, transaction.name);
+            int64_t start_us = esp_timer_get_time();
+            bool succeeded = transaction.operation();
+            int64_t duration_us = esp_timer_get_time() - start_us;
+            Timeline::instance().end(TimelineKind::Read, transaction.name);
+
+            completed_count += 1;
+            failed_count += succeeded ? 0 : 1;
+            busy_us += duration_us;
+            max_duration_us = std::max(max_duration_us, duration_us);
+
+            if (transaction.on_complete)
+            {
+                transaction.on_complete({ transaction.name, succeeded, duration_us });
+            }
+        }
+
+        return res;
+    }
+
+    // Print the bus statistics
+    void I2cBusQueue::print_statistics() const
+    {
+        Log::info(TAG, "{}: completed={} failed={} rejected={} busy={}us max={}us",
+                  bus_name, completed_count, failed_count, rejected_count, busy_us, max_duration_us);
+    }
+}
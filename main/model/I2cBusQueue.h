@@ -0,0 +1,82 @@
+/****************************************************************************************
+ * I2cBusQueue.h - A queue of I2C transactions waiting to be performed on one I2C bus
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+namespace redstone
+{
+    /// The result of one I2C transaction, reported to the completion callback
+    struct I2cTransactionResult
+    {
+        const char* name;
+        bool succeeded;
+        int64_t duration_us;
+    };
+
+    class I2cBusQueue
+    {
+        public:
+            using Operation = std::function<bool()>;
+            using Completion = std::function<void(const I2cTransactionResult&)>;
+
+            /// Constructor
+            /// \param bus_name The name of the bus, used when printing statistics
+            /// \param capacity The maximum number of transactions that can be waiting
+            I2cBusQueue(const char* bus_name, size_t capacity);
+
+            /// Add a transaction to the end of the queue
+            /// \param name The name of the transaction
+            /// \param operation The function that performs the transaction, returns true on success
+            /// \param on_complete The function called with the result once the transaction has been performed
+            /// \return true if queued, false if the queue is full
+            bool enqueue(const char* name, Operation operation, Completion on_complete);
+
+            /// Perform the transaction at the front of the queue
+            /// \return true if a transaction was performed, false if the queue is empty
+            bool process_next();
+
+            /// Get the number of transactions waiting
+            size_t pending() const
+            {
+                return transactions.size();
+            }
+
+            /// Print the bus statistics
+            void print_statistics() const;
+
+        private:
+            struct Transaction
+            {
+                const char* name;
+                Operation operation;
+                Completion on_complete;
+            };
+
+            const char* bus_name;
+            size_t capacity;
+            std::deque<Transaction> transactions{};
+
+            uint32_t completed_count{ 0 };
+            uint32_t failed_count{ 0 };
+            uint32_t rejected_count{ 0 };
+            int64_t busy_us{ 0 };
+            int64_t max_duration_us{ 0 };
+    };
+}
@@ -0,0 +1,64 @@
+/****************************************************************************************
+ * ISampleStore.h - An abstract class that the storage backends of the sample log
+ *                  implement to append, recover and read back SampleLogBlocks
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace redstone
+{
+    class ISampleStore
+    {
+        public:
+            virtual ~ISampleStore() {};
+
+            /// Open the storage and find the valid blocks, logging the time it took
+            /// \return false if the storage can't be used
+            virtual bool initialize() = 0;
+
+            /// Erase all blocks
+            virtual bool clear() = 0;
+
+            /// Append a block, the oldest blocks are dropped when the storage is full
+            /// \param data The block, SampleLogBlock::BLOCK_SIZE bytes
+            /// \return true if the block was written
+            virtual bool append(const uint8_t* data) = 0;
+
+            /// Get the number of valid blocks
+            virtual size_t get_block_count() const = 0;
+
+            /// Get a valid block
+            /// \param index The index of the block, 0 is the oldest
+            /// \param buffer A buffer of SampleLogBlock::BLOCK_SIZE bytes the block is read into
+            ///               by a store that can't map its blocks
+            /// \return The block, in buffer or in the mapped storage, nullptr if it can't be read
+            virtual const uint8_t* get_block(size_t index, uint8_t* buffer) = 0;
+
+            /// Get the sequence number of the newest block, 0 if there are no blocks
+            virtual uint32_t get_last_sequence() const = 0;
+
+            /// Get the highest boot number of the blocks, 0 if there are no blocks
+            virtual uint16_t get_last_boot() const = 0;
+
+            /// Get the time the boot scan of initialize() took in microseconds
+            virtual int64_t get_scan_us() const = 0;
+
+            /// Get the name of the store
+            virtual const char* get_name() const = 0;
+    };
+}
@@ -0,0 +1,127 @@
+/****************************************************************************************
+ * LatencyProbe.cpp - Measures the time from publishing a value to showing it on screen
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/LatencyProbe.h"
+#include <algorithm>
+#include <cstring>
+#include <smooth/core/logging/log.h>
+#include "model/Timeline.h"
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "LatencyProbe";
+
+    // Get the probe
+    LatencyProbe& LatencyProbe::instance()
+    {
+        static LatencyProbe probe;
+
+        return probe;
+    }
+
+    // A content pane received a value
+    void LatencyProbe::value_received(const char* pane, uint32_t sequence, int64_t timestamp_us)
+    {
+        Timeline::instance().frame_received(sequence);
+        std::lock_guard<std::mutex> lock(guard);
+
+        auto stats = std::find_if(panes.begin(), panes.end(), [pane](const PaneStatistics& s) {
+                                      return std::strcmp(s.name, pane) == 0;
+                                  });
+
+        if (stats == panes.end())
+        {
+            // the first value received, the values published before the pane existed are not drops
+            panes.push_back(PaneStatistics{ pane, sequence, 1, 0 });
+        }
+        else
+        {
+            if (sequence > stats->last_sequence + 1)
+            {
+                stats->dropped += sequence - stats->last_sequence - 1;
+            }
+
+            stats->last_sequence = sequence;
+            stats->received += 1;
+        }
+
+        if (pending == 0)
+        {
+            pending_oldest_us = timestamp_us;
+            pending_newest_us = timestamp_us;
+        }
+
+        pending_oldest_us = std::min(pending_oldest_us, timestamp_us);
+        pending_newest_us = std::max(pending_newest_us, timestamp_us);
+
+        pending += 1;
+        pending_timestamp_sum_us += timestamp_us;
+    }
+
+    // A frame has been flushed, all values received since the last flush are now shown
+    void LatencyProbe::frame_flushed(int64_t now_us)
+    {
+        std::lock_guard<std::mutex> lock(guard);
+
+        if (pending > 0)
+        {
+            int64_t newest_latency_us = now_us - pending_newest_us;
+            int64_t oldest_latency_us = now_us - pending_oldest_us;
+
+            latency_min_us = latency_count == 0 ? newest_latency_us : std::min(latency_min_us, newest_latency_us);
+            latency_max_us = std::max(latency_max_us, oldest_latency_us);
+            latency_sum_us += now_us * pending - pending_timestamp_sum_us;
+            latency_count += pending;
+
+            pending = 0;
+            pending_timestamp_sum_us = 0;
+        }
+    }
+
+    // Get the number of values not received by the panes
+    uint32_t LatencyProbe::get_dropped()
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        uint32_t dropped = 0;
+
+        for (const auto& stats : panes)
+        {
+            dropped += stats.dropped;
+        }
+
+        return dropped;
+    }
+
+    // Log the latency and the received and dropped values of each pane
+    void LatencyProbe::print_statistics()
+    {
+        std::lock_guard<std::mutex> lock(guard);
+
+        Log::info(TAG, "publish to render latency: values={} min={} us avg={} us max={} us",
+                  latency_count,
+                  latency_min_us,
+                  latency_count > 0 ? latency_sum_us / latency_count : 0,
+                  latency_max_us);
+
+        for (const auto& stats : panes)
+        {
+            Log::info(TAG, "{}: received={} dropped={}", stats.name, stats.received, stats.dropped);
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/****************************************************************************************
+ * LatencyProbe.h - Measures the time from publishing a value to showing it on screen
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Each content pane reports the values it receives and the display driver reports each
+//  flushed frame.  The latency of a value is the time from its publishing to the end of
+//  the first flush after it was received.  A value a pane never received, because its
+//  queue was full or its mailbox was given a newer value first, shows up as a gap in the
+//  sequence numbers and is counted as dropped.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace redstone
+{
+    class LatencyProbe
+    {
+        public:
+            /// Get the probe
+            static LatencyProbe& instance();
+
+            /// A content pane received a value
+            /// \param pane The name of the pane, a string literal
+            /// \param sequence The sequence number of the value
+            /// \param timestamp_us The time the value was published
+            void value_received(const char* pane, uint32_t sequence, int64_t timestamp_us);
+
+            /// A frame has been flushed to the display
+            /// \param now_us The current time in microseconds
+            void frame_flushed(int64_t now_us);
+
+            /// Get the number of values not received by the panes
+            uint32_t get_dropped();
+
+            /// Log the latency and the received and dropped values of each pane
+            void print_statistics();
+
+        private:
+            /// Constructor
+            LatencyProbe() = default;
+
+            struct PaneStatistics
+            {
+                const char* name;
+                uint32_t last_sequence;
+                uint32_t received;
+                uint32_t dropped;
+            };
+
+            std::mutex guard{};
+            std::vector<PaneStatistics> panes{};
+
+            // the values received since the last flush
+            uint32_t pending{ 0 };
+            int64_t pending_timestamp_sum_us{ 0 };
+            int64_t pending_oldest_us{ 0 };
+            int64_t pending_newest_us{ 0 };
+
+            uint32_t latency_count{ 0 };
+            int64_t latency_sum_us{ 0 };
+            int64_t latency_max_us{ 0 };
+            int64_t latency_min_us{ 0 };
+    };
+}
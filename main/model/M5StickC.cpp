@@ -52,10 +52,10 @@
 
 #include <smooth/core/logging/log.h>
 #include <smooth/application/io/i2c/AxpRegisters.h>
-#include <smooth/core/ipc/Publisher.h>
+#include <esp_timer.h>
+#include <algorithm>
 
 using namespace smooth::core::logging;
-using namespace smooth::core::ipc;
 using namespace smooth::application::sensor;
 
 namespace redstone
@@ -115,7 +115,7 @@ namespace redstone
     // Initialize the AXP192
     void M5StickC::initialize_axp192()
     {
-        auto device = i2c0_master.create_device<AxpPMU>(0x34);   // AXP i2c device address  0x34
+        auto device = i2c0_master.create_device<Axp192>(0x34);   // AXP i2c device address  0x34
         Log::info(TAG, "Scanning for Axp192 ---- {}", device->is_present() ? "device found" : "device NOT present");
 
         if (device->is_present())
@@ -134,46 +134,131 @@ namespace redstone
 
     // Read the measuremnets from AXP192
     void M5StickC::read_axp_measurements()
+    {
+        if (read_axp())
+        {
+            stamp_axp_measurements();
+        }
+    }
+
+    // Read measurement from the AXP192 using the current read mode
+    bool M5StickC::read_axp()
+    {
+        return timed_axp_read(axp_read_mode);
+    }
+
+    // Stamp the latest AXP192 measurements
+    void M5StickC::stamp_axp_measurements()
+    {
+        axp_value.set_sequence(axp_value.get_sequence() + 1);
+        axp_value.set_timestamp_us(esp_timer_get_time());
+    }
+
+    // Set how the AXP192 measurements are read
+    void M5StickC::set_axp_read_mode(AxpReadMode mode)
+    {
+        axp_read_mode = mode;
+    }
+
+    // Read the AXP192 measurements and update the statistics for the mode
+    bool M5StickC::timed_axp_read(AxpReadMode mode)
+    {
+        if (!axp192_initialized)
+        {
+            return false;
+        }
+
+        bool block_read = mode == AxpReadMode::BlockRead;
+        AxpReadStatistics& stats = block_read ? block_read_stats : register_read_stats;
+
+        int64_t start_us = esp_timer_get_time();
+        bool res = block_read ? axp192->read_adc_block(axp_value) : read_axp_register_by_register();
+        int64_t elapsed_us = esp_timer_get_time() - start_us;
+
+        stats.reads += 1;
+        stats.transactions += block_read ? Axp192::BLOCK_READ_TRANSACTIONS : Axp192::REGISTER_READ_TRANSACTIONS;
+        stats.last_us = elapsed_us;
+        stats.min_us = std::min(stats.min_us, elapsed_us);
+        stats.max_us = std::max(stats.max_us, elapsed_us);
+        stats.total_us += elapsed_us;
+
+        return res;
+    }
+
+    // Read the AXP192 measurements using the AxpPMU getters
+    bool M5StickC::read_axp_register_by_register()
     {
         float value;
+        bool res = true;
 
-        axp192->get_acin_voltage(value);
+        res &= axp192->get_acin_voltage(value);
         axp_value.set_acin_voltage(value);
 
-        axp192->get_acin_current(value);
+        res &= axp192->get_acin_current(value);
         axp_value.set_acin_current(value);
 
-        axp192->get_vbus_voltage(value);
+        res &= axp192->get_vbus_voltage(value);
         axp_value.set_vbus_voltage(value);
 
-        axp192->get_vbus_current(value);
+        res &= axp192->get_vbus_current(value);
         axp_value.set_vbus_current(value);
 
-        axp192->get_ts_voltage(value);
+        res &= axp192->get_ts_voltage(value);
         axp_value.set_ts_pin_voltage(value);
 
-        axp192->get_aps_voltage(value);
+        res &= axp192->get_aps_voltage(value);
         axp_value.set_aps_voltage(value);
 
-        axp192->get_axp_device_temperature(value);
+        res &= axp192->get_axp_device_temperature(value);
         axp_value.set_axp_device_temperature(value);
 
-        axp192->get_battery_voltage(value);
+        res &= axp192->get_battery_voltage(value);
         axp_value.set_battery_voltage(value);
 
-        axp192->get_battery_charging_current(value);
+        res &= axp192->get_battery_charging_current(value);
         axp_value.set_battery_charging_current(value);
 
-        axp192->get_battery_discharging_current(value);
+        res &= axp192->get_battery_discharging_current(value);
         axp_value.set_battery_discharging_current(value);
 
-        axp192->get_battery_capacity(value);
+        res &= axp192->get_battery_capacity(value);
         axp_value.set_battery_capacity(value);
 
-        axp192->get_battery_power(value);
+        res &= axp192->get_battery_power(value);
         axp_value.set_battery_power(value);
 
-        Publisher<AxpValue>::publish(axp_value);
+        return res;
+    }
+
+    // Read the AXP192 measurements once in each mode and log the results
+    void M5StickC::measure_axp_read_modes()
+    {
+        int64_t register_start_us = esp_timer_get_time();
+        timed_axp_read(AxpReadMode::RegisterByRegister);
+        int64_t register_us = esp_timer_get_time() - register_start_us;
+
+        int64_t block_start_us = esp_timer_get_time();
+        timed_axp_read(AxpReadMode::BlockRead);
+        int64_t block_us = esp_timer_get_time() - block_start_us;
+
+        Log::info(TAG, "Axp192 register-by-register: {} transactions {} us", Axp192::REGISTER_READ_TRANSACTIONS, register_us);
+        Log::info(TAG, "Axp192 block read          : {} transactions {} us", Axp192::BLOCK_READ_TRANSACTIONS, block_us);
+    }
+
+    // Print AXP192 read statistics
+    void M5StickC::print_axp_read_statistics()
+    {
+        auto print = [](const char* name, const AxpReadStatistics& stats) {
+                         if (stats.reads > 0)
+                         {
+                             Log::info(TAG, "{} reads={} transactions={} last={}us min={}us max={}us avg={}us",
+                                       name, stats.reads, stats.transactions, stats.last_us,
+                                       stats.min_us, stats.max_us, stats.total_us / stats.reads);
+                         }
+                     };
+
+        print("Axp192 register-by-register:", register_read_stats);
+        print("Axp192 block read          :", block_read_stats);
     }
 
     // Print AXP192 report
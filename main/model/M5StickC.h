@@ -17,16 +17,41 @@
 #pragma once
 
 #include <memory>                   // for unique_ptr
+#include <cstdint>
 #include <smooth/core/io/i2c/Master.h>
 #include <smooth/application/io/i2c/PCF8563.h>
-#include <smooth/application/io/i2c/AxpPMU.h>
+#include "model/Axp192.h"
 #include "model/AxpValue.h"
+#include "model/SensorScheduler.h"
 
 namespace redstone
 {
     class M5StickC
     {
         public:
+            /// How the AXP192 measurements are read
+            enum class AxpReadMode
+            {
+                RegisterByRegister,     // one I2C transaction per AxpPMU getter
+                BlockRead               // two I2C transactions for all measurements
+            };
+
+            /// Timing statistics of the AXP192 measurement reads
+            struct AxpReadStatistics
+            {
+                uint32_t reads{ 0 };
+                uint32_t transactions{ 0 };
+                int64_t last_us{ 0 };
+                int64_t min_us{ INT64_MAX };
+                int64_t max_us{ 0 };
+                int64_t total_us{ 0 };
+            };
+
+            /// The AXP192 is sampled at 1Hz, offset from the Envir HAT reads. When the BMP280
+            /// is present the AXP192 is read in the BMP280 sample set instead, during the
+            /// BMP280 conversion.
+            static constexpr SamplingSpec AXP192_SAMPLING{ std::chrono::seconds(1), std::chrono::milliseconds(250) };
+
             /// Constructor
             M5StickC();
 
@@ -37,9 +62,40 @@ namespace redstone
             /// \param brightness The brightness level; 0x00=1.8V=Dark, 0x0F=3.3V=Bright
             void set_screen_brightness(uint8_t brightness);
 
-            /// Read measurement from the AxpPMU device
+            /// Read measurement from the AxpPMU device and stamp them
             void read_axp_measurements();
 
+            /// Read measurement from the AxpPMU device using the current read mode
+            /// \return true on success, false if not initialized or the read failed
+            bool read_axp();
+
+            /// Stamp the latest AxpPMU measurements with the time and a sequence number, they
+            /// are published in the next SensorFrame
+            void stamp_axp_measurements();
+
+            /// Get the latest AxpPMU measurements, as last stamped
+            const AxpValue& get_axp_value() const
+            {
+                return axp_value;
+            }
+
+            /// Is the AXP192 initialized
+            bool is_axp192_initialized() const
+            {
+                return axp192_initialized;
+            }
+
+            /// Set how the AXP192 measurements are read
+            /// \param mode The read mode
+            void set_axp_read_mode(AxpReadMode mode);
+
+            /// Read the AXP192 measurements once in each read mode and log the
+            /// transaction count and time taken by each mode
+            void measure_axp_read_modes();
+
+            /// Print the AXP192 read statistics
+            void print_axp_read_statistics();
+
             /// Print the Axp192 measurements
             void print_axp192_report();
 
@@ -71,12 +127,23 @@ namespace redstone
             /// Initialize the GYRO MPU6886 - to be completed later
             void initialize_gyro_mpu6886();
 
+            /// Read the AXP192 measurements using the AxpPMU getters
+            bool read_axp_register_by_register();
+
+            /// Read the AXP192 measurements and update the statistics for the mode
+            /// \param mode The read mode
+            /// \return true on success, false on failure
+            bool timed_axp_read(AxpReadMode mode);
+
             smooth::core::io::i2c::Master i2c0_master;
-            std::unique_ptr<smooth::application::sensor::AxpPMU> axp192{};
+            std::unique_ptr<Axp192> axp192{};
             std::unique_ptr<smooth::application::sensor::PCF8563> bm8563{};
 
             bool axp192_initialized{ false };
             bool bm8563_initialized{ false };
             AxpValue axp_value;
+            AxpReadMode axp_read_mode{ AxpReadMode::BlockRead };
+            AxpReadStatistics register_read_stats{};
+            AxpReadStatistics block_read_stats{};
     };
 }
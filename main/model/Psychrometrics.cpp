@@ -0,0 +1,156 @@
+/****************************************************************************************
+ * Psychrometrics.cpp - Single precision psychrometric and barometric calculations
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/Psychrometrics.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace redstone
+{
+    // Class constants
+    static constexpr float LN2 = 0.693147181f;
+    static constexpr float INV_LN2 = 1.44269504f;
+    static constexpr float SQRT2 = 1.41421356f;
+
+    // Magnus formula, Alduchov and Eskridge 1996
+    static constexpr float MAGNUS_A = 6.1094f;     // hPa
+    static constexpr float MAGNUS_B = 17.625f;
+    static constexpr float MAGNUS_C = 243.04f;     // degree celsius
+
+    static constexpr float LAPSE_RATE = 0.0065f;   // K/m
+    static constexpr float BAROMETRIC_EXPONENT = 5.257f;
+    static constexpr float KELVIN = 273.15f;
+
+    // e to the power of x: x = n * ln2 + r with |r| <= ln2 / 2, e^r by a degree 6 Taylor polynomial
+    float Psychrometrics::exp(float x)
+    {
+        x = x < -87.0f ? -87.0f : (x > 88.0f ? 88.0f : x);
+
+        float scaled = x * INV_LN2;
+        auto n = static_cast<int32_t>(scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+        float r = x - static_cast<float>(n) * LN2;
+
+        float p = 1.0f + r * (1.0f + r * (0.5f + r * (1.0f / 6 + r * (1.0f / 24 + r * (1.0f / 120 + r * (1.0f / 720))))));
+
+        // 2^n by building the exponent of the float
+        uint32_t bits = static_cast<uint32_t>(n + 127) << 23;
+        float two_n;
+        std::memcpy(&two_n, &bits, sizeof(two_n));
+
+        return p * two_n;
+    }
+
+    // Natural logarithm: x = m * 2^e with m in [sqrt(0.5), sqrt(2)), ln(m) = 2 atanh(s) with s = (m - 1) / (m + 1)
+    float Psychrometrics::ln(float x)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+
+        int32_t e = static_cast<int32_t>((bits >> 23) & 0xFF) - 127;
+        bits = (bits & 0x007FFFFF) | 0x3F800000;
+
+        float m;
+        std::memcpy(&m, &bits, sizeof(m));
+
+        if (m > SQRT2)
+        {
+            m *= 0.5f;
+            e += 1;
+        }
+
+        float s = (m - 1.0f) / (m + 1.0f);
+        float s2 = s * s;
+        float atanh = s * (1.0f + s2 * (1.0f / 3 + s2 * (1.0f / 5 + s2 * (1.0f / 7 + s2 * (1.0f / 9)))));
+
+        return 2.0f * atanh + static_cast<float>(e) * LN2;
+    }
+
+    // x to the power of y
+    float Psychrometrics::pow(float x, float y)
+    {
+        return exp(y * ln(x));
+    }
+
+    // Saturation vapor pressure over water
+    float Psychrometrics::saturation_vapor_pressure_hPa(float temperature)
+    {
+        return MAGNUS_A * exp(MAGNUS_B * temperature / (MAGNUS_C + temperature));
+    }
+
+    // Dew point, the inverse of the Magnus formula
+    float Psychrometrics::dew_point_celsius(float temperature, float humidity)
+    {
+        humidity = humidity < 1.0f ? 1.0f : humidity;
+
+        float gamma = ln(humidity * 0.01f) + MAGNUS_B * temperature / (MAGNUS_C + temperature);
+
+        return MAGNUS_C * gamma / (MAGNUS_B - gamma);
+    }
+
+    // Heat index, http://www.wpc.ncep.noaa.gov/html/heatindex_equation.shtml
+    float Psychrometrics::heat_index_fahrenheit(float temperature, float humidity)
+    {
+        float t = temperature * 1.8f + 32.0f;
+        float rh = humidity;
+
+        // Steadman's simple formula averaged with the temperature
+        float heat_index = 0.5f * (t + 61.0f + ((t - 68.0f) * 1.2f) + (rh * 0.094f));
+
+        if (heat_index > 79.0f)
+        {
+            // Rothfusz regression, the powers of t and rh factored out
+            heat_index = -42.379f + t * (2.04901523f + t * -0.00683783f)
+                         + rh * (10.14333127f + rh * -0.05481717f)
+                         + t * rh * (-0.22475541f + t * 0.00122874f + rh * (0.00085282f + t * -0.00000199f));
+
+            if (rh < 13.0f && t >= 80.0f && t <= 112.0f)
+            {
+                float deviation = t > 95.0f ? t - 95.0f : 95.0f - t;
+                heat_index -= ((13.0f - rh) * 0.25f) * std::sqrt((17.0f - deviation) * 0.05882f);
+            }
+
+            if (rh > 85.0f && t >= 80.0f && t <= 87.0f)
+            {
+                heat_index += ((rh - 85.0f) * 0.1f) * ((87.0f - t) * 0.2f);
+            }
+        }
+
+        return heat_index;
+    }
+
+    // Sea level pressure, the barometric formula with the temperature at the sensor
+    float Psychrometrics::sea_level_pressure_hPa(float pressure, float temperature, float altitude)
+    {
+        float lapse = LAPSE_RATE * altitude;
+
+        return pressure * pow(1.0f - lapse / (temperature + lapse + KELVIN), -BAROMETRIC_EXPONENT);
+    }
+
+    // Absolute humidity from the vapor pressure and the gas constant of water vapor
+    float Psychrometrics::absolute_humidity_g_m3(float temperature, float humidity)
+    {
+        float vapor_pressure = saturation_vapor_pressure_hPa(temperature) * humidity * 0.01f;
+
+        return 216.7f * vapor_pressure / (temperature + KELVIN);
+    }
+
+    // Vapor pressure deficit
+    float Psychrometrics::vapor_pressure_deficit_kPa(float temperature, float humidity)
+    {
+        return saturation_vapor_pressure_hPa(temperature) * (1.0f - humidity * 0.01f) * 0.1f;
+    }
+}
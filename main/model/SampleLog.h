@@ -0,0 +1,175 @@
+/****************************************************************************************
+ * SampleLog.h - The block format of the persistent sample log
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The log is a sequence of 4096 byte blocks, the flash sector size, so every append
+//  writes whole sectors.  All header values are little endian.
+//
+//      header, 28 bytes
+//          uint32  magic "SLG2"
+//          uint32  sequence, incremented for every block written
+//          uint16  boot, incremented on every boot
+//          uint16  number of records
+//          uint16  number of payload bytes
+//          uint16  0
+//          uint32  time of the first record, seconds since boot
+//          uint32  time of the last record
+//          uint32  CRC-32 of the header after the magic and the payload
+//      payload, a bit stream of the records, most significant bit first
+//      zero padding to the end of the block
+//
+//  Every field is quantized to 16 bits as before, the largest value of the type meaning
+//  no value:
+//      temperatures 0.01C signed,  humidity 0.01%RH,  pressure above 300hPa 0.02hPa,
+//      voltages 1mV,  battery current 0.1mA signed
+//
+//  The slowly changing values compress well as differences.  Each record holds
+//      time    the delta of the delta from the previous record, zigzag coded:
+//                  0                       the same interval as before
+//                  10   + 7 bits           |delta of delta| < 64
+//                  110  + 12 bits          < 2048
+//                  1110 + 20 bits          < 2^19
+//                  1111 + 32 bits          the time itself
+//      fields  the 16 bit difference from the previous record, zigzag coded:
+//                  0                       unchanged
+//                  10  + 4 bits            |difference| < 8
+//                  110 + 8 bits            < 128
+//                  111 + 16 bits           the value itself
+//  The first record of a block is coded against a time and values of 0, so every block
+//  decodes on its own and a range query only decodes the blocks of the range.
+//
+//  A block whose magic or CRC is wrong was not completely written.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "model/TimeSeriesStore.h"
+
+namespace redstone
+{
+    /// A sample of all series fields
+    struct SampleRecord
+    {
+        uint32_t time_s;
+        std::array<float, TimeSeriesStore::FIELD_COUNT> values;     // indexed by SeriesField, NaN if no value
+    };
+
+    class SampleLogBlock
+    {
+        public:
+            static constexpr size_t BLOCK_SIZE = 4096;
+            static constexpr size_t HEADER_SIZE = 28;
+            static constexpr size_t PAYLOAD_SIZE = BLOCK_SIZE - HEADER_SIZE;
+            static constexpr uint32_t MAGIC = 0x32474C53;       // "SLG2"
+
+            /// The largest record, the time and every field stored in full
+            static constexpr size_t MAX_RECORD_BITS = 4 + 32 + TimeSeriesStore::FIELD_COUNT * (3 + 16);
+
+            /// Start a new block
+            /// \param sequence The sequence number of the block
+            /// \param boot The boot number
+            void start(uint32_t sequence, uint16_t boot);
+
+            /// Add a record
+            /// \param record The record
+            /// \return false if the block is full
+            bool add(const SampleRecord& record);
+
+            /// Set the header and get the block to write, more records can be added after it
+            /// \param return Return the complete block
+            const uint8_t* finish();
+
+            /// Check a block read from the log
+            /// \param data The block, BLOCK_SIZE bytes
+            /// \return true if the magic and CRC are valid
+            static bool is_valid(const uint8_t* data);
+
+            /// Get the sequence number of a valid block
+            static uint32_t get_sequence(const uint8_t* data);
+
+            /// Get the boot number of a valid block
+            static uint16_t get_boot(const uint8_t* data);
+
+            /// Get the number of records of a valid block
+            static uint16_t get_record_count(const uint8_t* data);
+
+            /// Get the number of payload bytes of a valid block
+            static uint16_t get_payload_size(const uint8_t* data);
+
+            /// Get the time of the first record of a valid block
+            static uint32_t get_first_time_s(const uint8_t* data);
+
+            /// Get the time of the last record of a valid block
+            static uint32_t get_last_time_s(const uint8_t* data);
+
+            /// Get the number of records added
+            size_t get_record_count() const
+            {
+                return record_count;
+            }
+
+            /// Get the number of payload bytes used
+            size_t get_payload_size() const
+            {
+                return (bit_position + 7) / 8;
+            }
+
+            /// Calculate the CRC-32 (IEEE 802.3) of data
+            /// \param data The data
+            /// \param size The size of the data
+            /// \param crc The CRC of the preceding data, to continue a calculation
+            static uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+        private:
+            /// Append bits to the payload
+            void put_bits(uint32_t value, size_t bits);
+
+            std::array<uint8_t, BLOCK_SIZE> block{};
+            size_t record_count{ 0 };
+            size_t bit_position{ 0 };
+            uint32_t first_time_s{ 0 };
+            uint32_t previous_time_s{ 0 };
+            uint32_t previous_interval_s{ 0 };
+            std::array<uint16_t, TimeSeriesStore::FIELD_COUNT> previous_raw{};
+    };
+
+    class SampleLogBlockReader
+    {
+        public:
+            /// Constructor
+            /// \param data A valid block, it must outlive the reader
+            explicit SampleLogBlockReader(const uint8_t* data);
+
+            /// Read the next record
+            /// \param record The record read
+            /// \return false when there are no more records
+            bool next(SampleRecord& record);
+
+        private:
+            /// Take bits from the payload
+            uint32_t get_bits(size_t bits);
+
+            const uint8_t* payload;
+            size_t remaining_records;
+            size_t bit_position{ 0 };
+            uint32_t previous_time_s{ 0 };
+            uint32_t previous_interval_s{ 0 };
+            std::array<uint16_t, TimeSeriesStore::FIELD_COUNT> previous_raw{};
+    };
+}
@@ -0,0 +1,304 @@
+/****************************************************************************************
+ * SampleLogger.cpp - Appends the sensor samples to a log in flash
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/SampleLogger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <esp_timer.h>
+#include <smooth/core/logging/log.h>
+#include "model/FatSampleStore.h"
+#include "model/RawPartitionSampleStore.h"
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "SampleLogger";
+
+    // Open the store and find where to append
+    bool SampleLogger::initialize()
+    {
+        if (STORE_TYPE == SampleStoreType::RawPartition)
+        {
+            store = std::make_unique<RawPartitionSampleStore>("sample_log");
+        }
+        else
+        {
+            store = std::make_unique<FatSampleStore>("samples", FAT_FILE_BLOCKS);
+        }
+
+        initialized = store->initialize();
+
+        if (initialized)
+        {
+            next_sequence = store->get_last_sequence() + 1;
+            boot = static_cast<uint16_t>(store->get_last_boot() + 1);
+            block = std::make_unique<SampleLogBlock>();
+            block->start(next_sequence, boot);
+            last_flush_us = esp_timer_get_time();
+            Log::info(TAG, "Sample log on {}: boot={} blocks={} scan={}us",
+                      store->get_name(), boot, store->get_block_count(), store->get_scan_us());
+        }
+        else
+        {
+            Log::error(TAG, "The {} store can't be used, samples are not logged", store->get_name());
+        }
+
+        return initialized;
+    }
+
+    // Add a sample, appending the block if it is full or due
+    void SampleLogger::add(const SampleRecord& record, int64_t now_us)
+    {
+        if (initialized)
+        {
+            if (!block->add(record))
+            {
+                write_block();
+                last_flush_us = now_us;
+
+                // the block is still full while the flash can't be written
+                if (!block->add(record))
+                {
+                    records_dropped += 1;
+                }
+            }
+
+            bool was_low_battery = low_battery;
+            low_battery = is_low_battery(record);
+            int64_t interval_us = low_battery ? LOW_BATTERY_FLUSH_INTERVAL_US : FLUSH_INTERVAL_US;
+
+            // Don't lose the collected samples if the battery is about to run out
+            if ((low_battery && !was_low_battery) || now_us - last_flush_us >= interval_us)
+            {
+                write_block();
+                last_flush_us = now_us;
+            }
+        }
+    }
+
+    // Append the collected samples now
+    void SampleLogger::flush()
+    {
+        if (initialized && block->get_record_count() > 0)
+        {
+            write_block();
+            last_flush_us = esp_timer_get_time();
+        }
+    }
+
+    // Read the samples of this boot in a time range
+    size_t SampleLogger::read_records(uint32_t from_s, uint32_t to_s, SampleRecord* records, size_t max_records)
+    {
+        size_t total = 0;
+
+        if (max_records > 0)
+        {
+            // Keep the newest samples in records used as a ring
+            visit_records(from_s, to_s, max_records, [records, max_records, &total](const SampleRecord& record) {
+                              records[total % max_records] = record;
+                              total += 1;
+                          });
+
+            if (total > max_records)
+            {
+                std::rotate(records, records + total % max_records, records + max_records);
+            }
+        }
+
+        return std::min(total, max_records);
+    }
+
+    // Decode the samples of this boot in a time range one at a time
+    void SampleLogger::for_each_record(uint32_t from_s, uint32_t to_s, const RecordVisitor& visit)
+    {
+        visit_records(from_s, to_s, SIZE_MAX, visit);
+    }
+
+    // Get the time span of the samples of this boot, on the block headers only
+    bool SampleLogger::get_span(uint32_t& oldest_s, uint32_t& newest_s)
+    {
+        bool res = false;
+
+        if (initialized)
+        {
+            std::vector<uint8_t> buffer(STORE_TYPE == SampleStoreType::Fat ? SampleLogBlock::BLOCK_SIZE : 0);
+            size_t index = store->get_block_count();
+            bool more = true;
+
+            if (block->get_record_count() > 0)
+            {
+                const uint8_t* collected = block->finish();
+                oldest_s = SampleLogBlock::get_first_time_s(collected);
+                newest_s = SampleLogBlock::get_last_time_s(collected);
+                res = true;
+            }
+
+            while (more && index > 0)
+            {
+                const uint8_t* data = store->get_block(index - 1, buffer.data());
+                more = data != nullptr && SampleLogBlock::get_boot(data) == boot;
+
+                if (more)
+                {
+                    newest_s = res ? newest_s : SampleLogBlock::get_last_time_s(data);
+                    oldest_s = SampleLogBlock::get_first_time_s(data);
+                    res = true;
+                    index -= 1;
+                }
+            }
+        }
+
+        return res;
+    }
+
+    // Decode the samples of this boot in a time range, from the oldest block needed
+    void SampleLogger::visit_records(uint32_t from_s, uint32_t to_s, size_t max_records, const RecordVisitor& visit)
+    {
+        if (initialized)
+        {
+            // Only used by a store that can't map its blocks
+            std::vector<uint8_t> buffer{};
+
+            if (STORE_TYPE == SampleStoreType::Fat)
+            {
+                buffer.resize(SampleLogBlock::BLOCK_SIZE);
+            }
+
+            // Walk back from the newest block, on the block headers only, to the oldest block
+            // that can hold one of the newest max_records samples of the range
+            size_t blocks = store->get_block_count();
+            size_t oldest = blocks;
+            size_t certain = 0;
+            bool more = true;
+
+            // finish() only sets the header of the collected block, more records can be added after it
+            const uint8_t* collected = block->get_record_count() > 0 ? block->finish() : nullptr;
+
+            if (collected != nullptr
+                && SampleLogBlock::get_first_time_s(collected) >= from_s
+                && SampleLogBlock::get_last_time_s(collected) <= to_s)
+            {
+                certain = SampleLogBlock::get_record_count(collected);
+            }
+
+            while (more && oldest > 0 && certain < max_records)
+            {
+                const uint8_t* data = store->get_block(oldest - 1, buffer.data());
+                more = data != nullptr
+                       && SampleLogBlock::get_boot(data) == boot
+                       && SampleLogBlock::get_last_time_s(data) >= from_s;
+
+                if (more)
+                {
+                    oldest -= 1;
+                    bool inside = SampleLogBlock::get_first_time_s(data) >= from_s
+                                  && SampleLogBlock::get_last_time_s(data) <= to_s;
+                    certain += inside ? SampleLogBlock::get_record_count(data) : 0;
+                }
+            }
+
+            // Decode forward
+            for (size_t index = oldest; index < blocks; index++)
+            {
+                const uint8_t* data = store->get_block(index, buffer.data());
+
+                if (data != nullptr && SampleLogBlock::get_first_time_s(data) <= to_s)
+                {
+                    visit_block_records(data, from_s, to_s, visit);
+                }
+            }
+
+            if (collected != nullptr)
+            {
+                visit_block_records(collected, from_s, to_s, visit);
+            }
+        }
+    }
+
+    // Decode the samples of a block in a time range
+    void SampleLogger::visit_block_records(const uint8_t* data, uint32_t from_s, uint32_t to_s,
+                                           const RecordVisitor& visit)
+    {
+        SampleLogBlockReader reader{ data };
+        SampleRecord record{};
+
+        while (reader.next(record) && record.time_s <= to_s)
+        {
+            if (record.time_s >= from_s)
+            {
+                visit(record);
+            }
+        }
+    }
+
+    // Check if the battery of a sample is low, below the voltage while discharging
+    bool SampleLogger::is_low_battery(const SampleRecord& record)
+    {
+        float voltage = record.values[static_cast<size_t>(SeriesField::BatteryVoltage)];
+        float current = record.values[static_cast<size_t>(SeriesField::BatteryCurrent)];
+
+        return !std::isnan(voltage) && !std::isnan(current) && voltage < LOW_BATTERY_VOLTAGE && current < 0.0f;
+    }
+
+    // Append the block to the store and start the next block
+    void SampleLogger::write_block()
+    {
+        int64_t start_us = esp_timer_get_time();
+
+        // Only a block that reached the flash counts, the same block is retried otherwise
+        bool written = store->append(block->finish());
+
+        int64_t write_us = esp_timer_get_time() - start_us;
+
+        if (written)
+        {
+            blocks_written += 1;
+            records_written += static_cast<uint32_t>(block->get_record_count());
+            bytes_written += SampleLogBlock::HEADER_SIZE + block->get_payload_size();
+            total_write_us += write_us;
+            max_write_us = std::max(max_write_us, write_us);
+            next_sequence += 1;
+            block->start(next_sequence, boot);
+        }
+        else
+        {
+            write_errors += 1;
+            Log::error(TAG, "Writing block {} failed", next_sequence);
+        }
+    }
+
+    // Log the blocks written, the write times and the recovery
+    void SampleLogger::print_statistics() const
+    {
+        if (initialized)
+        {
+            Log::info(TAG, "Sample log on {}: boot={} blocks={} scan={}us written={} errors={} pending={} dropped={}",
+                      store->get_name(), boot, store->get_block_count(), store->get_scan_us(),
+                      blocks_written, write_errors, block->get_record_count(), records_dropped);
+        }
+
+        if (blocks_written > 0)
+        {
+            Log::info(TAG, "Sample log write: avg={}us max={}us, {} records {:.1f} bits per record",
+                      total_write_us / blocks_written, max_write_us,
+                      records_written, records_written > 0 ? bytes_written * 8.0 / records_written : 0.0);
+        }
+    }
+}
@@ -0,0 +1,156 @@
+/****************************************************************************************
+ * SampleLogger.h - Appends the sensor samples to a log in flash
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The samples are collected in a SampleLogBlock in RAM and the block is appended to the
+//  store, as one aligned 4kB write, when it is full, when FLUSH_INTERVAL has passed or,
+//  every LOW_BATTERY_FLUSH_INTERVAL, while the battery is low.  A block is never
+//  rewritten, a flushed partial block is followed by a new block.  A block that fails to
+//  be written is kept and retried, the samples that don't fit while it is full are
+//  dropped and counted.
+//
+//  At the typical 7 bytes of a delta coded sample a block fills in about 97 minutes, so
+//  the 2 hour FLUSH_INTERVAL only cuts the blocks of samples that compress better than
+//  that short.  The 64 blocks of the sample_log partition keep about 4 days of samples
+//  and the two files of 56 blocks of the FAT store about 3.7 days.
+//
+//  The store is chosen by STORE_TYPE:
+//      RawPartition    a circular log on the sample_log partition, the default, see
+//                      RawPartitionSampleStore.h
+//      Fat             two files on the app_storage FAT partition, see FatSampleStore.h
+//  SampleStoreBenchmark compares the two.
+//
+//  The logger is owned by the SensorTask and must only be used on it, by HistoryQuery too.
+//
+//  host/tools/SampleLogReader prints the log as CSV.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include "model/ISampleStore.h"
+#include "model/SampleLog.h"
+#include "model/SensorScheduler.h"
+
+namespace redstone
+{
+    /// The storage backends of the sample log
+    enum class SampleStoreType
+    {
+        RawPartition,
+        Fat
+    };
+
+    class SampleLogger
+    {
+        public:
+            using RecordVisitor = std::function<void(const SampleRecord&)>;
+
+            /// A sample is logged every 10 seconds, between the sensor reads
+            static constexpr SamplingSpec SAMPLING{ std::chrono::seconds(10), std::chrono::milliseconds(750) };
+
+            /// The store the samples are logged to
+            static constexpr SampleStoreType STORE_TYPE = SampleStoreType::RawPartition;
+
+            /// The typical size of a delta coded sample, see SampleCodecReport
+            static constexpr size_t TYPICAL_RECORD_BYTES = 7;
+
+            /// The time a block of typical samples takes to fill
+            static constexpr int64_t TYPICAL_BLOCK_FILL_US =
+                static_cast<int64_t>(SampleLogBlock::PAYLOAD_SIZE / TYPICAL_RECORD_BYTES) * SAMPLING.period.count() * 1000;
+
+            /// A partial block is appended after 2 hours, longer than a block of typical samples lasts
+            static constexpr int64_t FLUSH_INTERVAL_US = 2LL * 60 * 60 * 1000 * 1000;
+            static_assert(FLUSH_INTERVAL_US >= TYPICAL_BLOCK_FILL_US, "a timed flush would append blocks part full");
+
+            /// While the battery is low a partial block is appended every minute
+            static constexpr int64_t LOW_BATTERY_FLUSH_INTERVAL_US = 60LL * 1000 * 1000;
+
+            /// The battery is low below this voltage while discharging
+            static constexpr float LOW_BATTERY_VOLTAGE = 3.45f;
+
+            /// The blocks per file of the FAT store, the two files use 448kB of the 528kB partition
+            static constexpr size_t FAT_FILE_BLOCKS = 56;
+
+            /// Open the store and find where to append
+            /// \return true on success, false if the store can't be used
+            bool initialize();
+
+            /// Add a sample, appending the block if it is due
+            /// \param record The sample
+            /// \param now_us The current time in microseconds
+            void add(const SampleRecord& record, int64_t now_us);
+
+            /// Append the collected samples now
+            void flush();
+
+            /// Read the samples of this boot in a time range, the appended and the collected ones
+            /// \param from_s The start of the time range in seconds since boot
+            /// \param to_s The end of the time range, inclusive
+            /// \param records The samples read, oldest first
+            /// \param max_records The size of records, the newest are read if there are more
+            /// \return The number of samples read
+            size_t read_records(uint32_t from_s, uint32_t to_s, SampleRecord* records, size_t max_records);
+
+            /// Decode the samples of this boot in a time range one at a time, holding at most one block
+            /// \param from_s The start of the time range in seconds since boot
+            /// \param to_s The end of the time range, inclusive
+            /// \param visit Called with each sample, oldest first
+            void for_each_record(uint32_t from_s, uint32_t to_s, const RecordVisitor& visit);
+
+            /// Get the time span of the samples of this boot, appended and collected
+            /// \param oldest_s The time of the oldest sample
+            /// \param newest_s The time of the newest sample
+            /// \return false if there are no samples
+            bool get_span(uint32_t& oldest_s, uint32_t& newest_s);
+
+            /// Log the blocks written, the write times and the recovery
+            void print_statistics() const;
+
+        private:
+            /// Check if the battery of a sample is low
+            static bool is_low_battery(const SampleRecord& record);
+
+            /// Append the block to the store and start the next block
+            void write_block();
+
+            /// Decode the samples of this boot in a time range, starting at the oldest block that
+            /// can hold one of the newest max_records samples of the range
+            void visit_records(uint32_t from_s, uint32_t to_s, size_t max_records, const RecordVisitor& visit);
+
+            /// Decode the samples of a block in a time range
+            static void visit_block_records(const uint8_t* data, uint32_t from_s, uint32_t to_s,
+                                            const RecordVisitor& visit);
+
+            std::unique_ptr<ISampleStore> store{};
+            std::unique_ptr<SampleLogBlock> block{};
+            bool initialized{ false };
+            uint32_t next_sequence{ 1 };
+            uint16_t boot{ 1 };
+            int64_t last_flush_us{ 0 };
+            bool low_battery{ false };
+
+            uint32_t blocks_written{ 0 };
+            uint32_t records_written{ 0 };
+            uint64_t bytes_written{ 0 };        // the header and payload bytes of the blocks
+            uint32_t write_errors{ 0 };
+            uint32_t records_dropped{ 0 };      // the records lost to a full block that could not be written
+            int64_t total_write_us{ 0 };
+            int64_t max_write_us{ 0 };
+    };
+}
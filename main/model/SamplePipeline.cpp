@@ -0,0 +1,149 @@
+/****************************************************************************************
+ * SamplePipeline.cpp - Overlaps sensor conversions with work on the other I2C bus
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/SamplePipeline.h"
+#include <algorithm>
+#include <smooth/core/logging/log.h>
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "SamplePipeline";
+
+    // Constructor
+    SamplePipeline::SamplePipeline(Clock clock, Sleep sleep) : clock(std::move(clock)), sleep(std::move(sleep))
+    {
+    }
+
+    // Add a split stage
+    void SamplePipeline::add_split_stage(const char* name, I2cBusQueue& bus, Start start, Work collect,
+                                         I2cBusQueue::Completion on_collected)
+    {
+        split_stages.push_back({ name, &bus, std::move(start), std::move(collect), std::move(on_collected), -1 });
+    }
+
+    // Add a single stage
+    void SamplePipeline::add_stage(const char* name, I2cBusQueue& bus, Work work, I2cBusQueue::Completion on_complete)
+    {
+        stages.push_back({ name, &bus, std::move(work), std::move(on_complete) });
+    }
+
+    // Remove all the stages
+    void SamplePipeline::clear()
+    {
+        split_stages.clear();
+        stages.clear();
+    }
+
+    // Queue a transaction and perform everything queued on the bus, a rejected one completes as failed
+    void SamplePipeline::perform(I2cBusQueue& bus, const char* name, Work work, I2cBusQueue::Completion on_complete)
+    {
+        bool queued = bus.enqueue(name, std::move(work), [this, on_complete](const I2cTransactionResult& result) {
+                                      stage_busy_us += result.duration_us;
+
+                                      if (on_complete)
+                                      {
+                                          on_complete(result);
+                                      }
+                                  });
+
+        if (!queued && on_complete)
+        {
+            on_complete({ name, false, 0 });
+        }
+
+        while (bus.process_next())
+        {
+        }
+    }
+
+    // Run one sample set
+    void SamplePipeline::run()
+    {
+        int64_t start_us = clock();
+        int64_t conversion_us = 0;
+        stage_busy_us = 0;
+
+        // 1. start the conversions
+        for (auto& stage : split_stages)
+        {
+            perform(*stage.bus, stage.name, [this, &stage, &conversion_us]() {
+                        int64_t wait_us = stage.start();
+                        stage.ready_us = wait_us < 0 ? -1 : clock() + wait_us;
+                        conversion_us += std::max<int64_t>(wait_us, 0);
+
+                        return wait_us >= 0;
+                    }, [&stage](const I2cTransactionResult& result) {
+                        // a conversion that failed to start is not collected, the start is its result
+                        if (!result.succeeded && stage.on_collected)
+                        {
+                            stage.on_collected(result);
+                        }
+                    });
+        }
+
+        // 2. perform the single stages while the conversions run
+        for (auto& stage : stages)
+        {
+            perform(*stage.bus, stage.name, stage.work, stage.on_complete);
+        }
+
+        // 3. collect the conversions in the order they complete
+        std::vector<SplitStage*> started;
+
+        for (auto& stage : split_stages)
+        {
+            if (stage.ready_us >= 0)
+            {
+                started.push_back(&stage);
+            }
+        }
+
+        std::sort(started.begin(), started.end(), [](const SplitStage* a, const SplitStage* b) {
+                      return a->ready_us < b->ready_us;
+                  });
+
+        for (auto stage : started)
+        {
+            int64_t wait_us = stage->ready_us - clock();
+
+            if (wait_us > 0)
+            {
+                sleep(wait_us);
+            }
+
+            perform(*stage->bus, stage->name, stage->collect, stage->on_collected);
+        }
+
+        last_wall_us = clock() - start_us;
+        last_serial_us = stage_busy_us + conversion_us;
+        total_wall_us += last_wall_us;
+        total_serial_us += last_serial_us;
+        runs += 1;
+    }
+
+    // Print the pipeline statistics
+    void SamplePipeline::print_statistics() const
+    {
+        if (runs > 0)
+        {
+            Log::info(TAG, "runs={} wall last={}us avg={}us, without overlap last={}us avg={}us",
+                      runs, last_wall_us, total_wall_us / runs, last_serial_us, total_serial_us / runs);
+        }
+    }
+}
@@ -0,0 +1,128 @@
+/****************************************************************************************
+ * SamplePipeline.h - Overlaps sensor conversions with work on the other I2C bus
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  A sample set is made of split stages, a conversion that is started and later
+//  collected, and single stages, a read that completes immediately.  run() performs
+//
+//      1. start every split stage (BMP280 forced conversion on i2c1)
+//      2. perform every single stage while the conversions run (AXP192 on i2c0)
+//      3. wait for the remaining conversion time and collect the split stages
+//
+//  so the wall-clock time of a sample set is about max(conversion, single stages)
+//  instead of their sum.  Every stage is performed through the I2cBusQueue of its bus
+//  so it is counted and reported like any other transaction.
+//
+//  The clock and the sleep are passed in, the pipeline does not depend on the device,
+//  so it can be run on Linux with stages that simulate the device latencies.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "model/I2cBusQueue.h"
+
+namespace redstone
+{
+    class SamplePipeline
+    {
+        public:
+            using Clock = std::function<int64_t()>;
+            using Sleep = std::function<void(int64_t)>;
+            using Start = std::function<int64_t()>;
+            using Work = std::function<bool()>;
+
+            /// Constructor
+            /// \param clock Returns the current time in microseconds
+            /// \param sleep Sleeps for the given number of microseconds
+            SamplePipeline(Clock clock, Sleep sleep);
+
+            /// Add a split stage
+            /// \param name The name of the stage
+            /// \param bus The queue of the bus the device is on
+            /// \param start Starts the conversion, returns the microseconds until it can be
+            /// collected or a negative value on failure
+            /// \param collect Collects the result, returns true on success
+            /// \param on_collected Called with the result of the collect, or of the start when it failed
+            void add_split_stage(const char* name, I2cBusQueue& bus, Start start, Work collect,
+                                 I2cBusQueue::Completion on_collected);
+
+            /// Add a single stage
+            /// \param name The name of the stage
+            /// \param bus The queue of the bus the device is on
+            /// \param work Performs the read, returns true on success
+            /// \param on_complete Called with the result of the read
+            void add_stage(const char* name, I2cBusQueue& bus, Work work, I2cBusQueue::Completion on_complete);
+
+            /// Remove all the stages
+            void clear();
+
+            /// Run one sample set
+            void run();
+
+            /// Get the wall-clock time of the last sample set in microseconds
+            int64_t get_last_wall_us() const
+            {
+                return last_wall_us;
+            }
+
+            /// Get the time the last sample set would have taken without overlapping,
+            /// the sum of the stage times and conversion times, in microseconds
+            int64_t get_last_serial_us() const
+            {
+                return last_serial_us;
+            }
+
+            /// Print the pipeline statistics
+            void print_statistics() const;
+
+        private:
+            struct SplitStage
+            {
+                const char* name;
+                I2cBusQueue* bus;
+                Start start;
+                Work collect;
+                I2cBusQueue::Completion on_collected;
+                int64_t ready_us;
+            };
+
+            struct Stage
+            {
+                const char* name;
+                I2cBusQueue* bus;
+                Work work;
+                I2cBusQueue::Completion on_complete;
+            };
+
+            /// Queue a transaction and perform everything queued on the bus
+            void perform(I2cBusQueue& bus, const char* name, Work work, I2cBusQueue::Completion on_complete);
+
+            Clock clock;
+            Sleep sleep;
+            std::vector<SplitStage> split_stages{};
+            std::vector<Stage> stages{};
+
+            int64_t stage_busy_us{ 0 };
+            int64_t last_wall_us{ 0 };
+            int64_t last_serial_us{ 0 };
+            int64_t total_wall_us{ 0 };
+            int64_t total_serial_us{ 0 };
+            uint32_t runs{ 0 };
+    };
+}
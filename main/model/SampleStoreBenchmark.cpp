@@ -0,0 +1,128 @@
+/****************************************************************************************
+ * SampleStoreBenchmark.cpp - Compares the raw partition and the FAT sample log stores
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/SampleStoreBenchmark.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <esp_timer.h>
+#include <smooth/core/logging/log.h>
+#include "model/FatSampleStore.h"
+#include "model/RawPartitionSampleStore.h"
+#include "model/SampleLog.h"
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "SampleStoreBenchmark";
+    static constexpr uint32_t BLOCKS = 32;
+    static constexpr size_t FAT_FILE_BLOCKS = 8;
+    static constexpr size_t RECORDS_PER_BLOCK = 200;
+
+    // The results are summed into this so the reads are not optimized away
+    static volatile float sink = 0;
+
+    // Benchmark a store, create makes a new instance to time the boot scan with
+    static void run_store(const std::function<std::unique_ptr<ISampleStore>()>& create)
+    {
+        std::unique_ptr<ISampleStore> store = create();
+
+        if (!store->initialize() || !store->clear())
+        {
+            Log::error(TAG, "{}: the store can't be used", store->get_name());
+            return;
+        }
+
+        // Full blocks of slowly changing samples
+        auto block = std::make_unique<SampleLogBlock>();
+        SampleRecord record{};
+        int64_t max_append_us = 0;
+        int64_t total_append_us = 0;
+        uint32_t failed = 0;
+        int64_t start_us = esp_timer_get_time();
+
+        for (uint32_t sequence = 1; sequence <= BLOCKS; sequence++)
+        {
+            block->start(sequence, 1);
+
+            for (size_t i = 0; block->get_record_count() < RECORDS_PER_BLOCK; i++)
+            {
+                record.time_s += 10;
+
+                for (size_t field = 0; field < TimeSeriesStore::FIELD_COUNT; field++)
+                {
+                    record.values[field] = 20.0f + static_cast<float>(field) + static_cast<float>(i % 50) * 0.01f;
+                }
+
+                block->add(record);
+            }
+
+            int64_t append_start_us = esp_timer_get_time();
+            failed += store->append(block->finish()) ? 0 : 1;
+            int64_t append_us = esp_timer_get_time() - append_start_us;
+
+            total_append_us += append_us;
+            max_append_us = std::max(max_append_us, append_us);
+        }
+
+        int64_t sustained_us = esp_timer_get_time() - start_us;
+        store.reset();
+
+        // The boot scan of the full store
+        store = create();
+        store->initialize();
+
+        // Get and decode every block
+        std::vector<uint8_t> buffer(SampleLogBlock::BLOCK_SIZE);
+        size_t blocks = store->get_block_count();
+        start_us = esp_timer_get_time();
+
+        for (size_t index = 0; index < blocks; index++)
+        {
+            const uint8_t* data = store->get_block(index, buffer.data());
+
+            if (data != nullptr)
+            {
+                SampleLogBlockReader reader{ data };
+
+                while (reader.next(record))
+                {
+                    sink = sink + record.values[0];
+                }
+            }
+        }
+
+        int64_t read_us = esp_timer_get_time() - start_us;
+
+        Log::info(TAG, "{}: append avg={}us max={}us failed={}, sustained {} samples/s",
+                  store->get_name(), total_append_us / BLOCKS, max_append_us, failed,
+                  BLOCKS * RECORDS_PER_BLOCK * 1000000LL / std::max(sustained_us, int64_t{ 1 }));
+        Log::info(TAG, "{}: boot scan {}us for {} blocks, read {}us per block",
+                  store->get_name(), store->get_scan_us(), blocks, blocks > 0 ? read_us / blocks : 0);
+
+        store->clear();
+    }
+
+    // Run the benchmarks of both stores
+    void SampleStoreBenchmark::run()
+    {
+        run_store([]() { return std::make_unique<RawPartitionSampleStore>("sample_bench"); });
+        run_store([]() { return std::make_unique<FatSampleStore>("bench", FAT_FILE_BLOCKS); });
+    }
+}
@@ -0,0 +1,41 @@
+/****************************************************************************************
+ * SampleStoreBenchmark.h - Compares the raw partition and the FAT sample log stores
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The benchmarks are run with the EnvirBenchmark ones, on the device by a SensorRequest
+//  and on the host with --bench.  Each store is cleared and then appended full blocks,
+//  several times its capacity, and the results are logged:
+//      append      the average and maximum time of an append
+//      sustained   the samples per second encoded and appended back to back
+//      boot scan   the time initialize() takes on the full store
+//      read        the time to get and decode a block, the range query cost
+//
+//  The raw partition store runs on the sample_bench partition and the FAT store on its
+//  own bench0.bin and bench1.bin files, so the sample log is left as it is.  Takes a few
+//  seconds on the device, mostly in the flash erases.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace redstone
+{
+    class SampleStoreBenchmark
+    {
+        public:
+            /// Run the benchmarks of both stores and log the results
+            static void run();
+    };
+}
@@ -0,0 +1,183 @@
+/****************************************************************************************
+ * SensorFrame.h - All the sensor values of an acquisition cycle, published as one
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The SensorTask publishes one frame per acquisition cycle, when the last read of the
+//  cycle completes, instead of an EnvirValue after every DHT12 or BMP280 read and an
+//  AxpValue after every AXP192 read.  A subscriber is woken and renders once per cycle
+//  and gets every field with one timestamp and sequence number.
+//
+//  The frame holds the latest EnvirValue and AxpValue, each still stamped with the time
+//  of its own read, and a validity bit per field.  A field is valid while the last read
+//  of its sensor succeeded, the DHT12 fields are read every other cycle and stay valid in
+//  between.  The derived values are valid with the measurements they are derived from.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include "model/AxpValue.h"
+#include "model/EnvirValue.h"
+
+namespace redstone
+{
+    /// The fields of a SensorFrame, each with a validity bit
+    enum class FrameField : uint8_t
+    {
+        Temperature,                // DHT12
+        Humidity,                   // DHT12
+        HeatIndex,                  // derived from the DHT12
+        DewPoint,                   // derived from the DHT12
+        AbsoluteHumidity,           // derived from the DHT12
+        VaporPressureDeficit,       // derived from the DHT12
+        Pressure,                   // BMP280
+        Bmp280Temperature,          // BMP280
+        SeaLevelPressure,           // derived from the BMP280
+        AcinVoltage,                // AXP192 ...
+        AcinCurrent,
+        VbusVoltage,
+        VbusCurrent,
+        BatteryVoltage,
+        ApsVoltage,
+        TsPinVoltage,
+        AxpTemperature,
+        BatteryChargingCurrent,
+        BatteryDischargingCurrent,
+        BatteryCapacity,
+        BatteryPower,
+        Count
+    };
+
+    /// Get the validity bit of a field
+    /// \param field The field
+    /// \param return Return the bit of the field
+    constexpr uint32_t get_frame_field_bit(FrameField field)
+    {
+        return uint32_t{ 1 } << static_cast<uint8_t>(field);
+    }
+
+    class SensorFrame
+    {
+        public:
+            /// The fields of each sensor, with the values derived from them
+            static constexpr uint32_t DHT12_FIELDS = get_frame_field_bit(FrameField::Temperature)
+                                                     | get_frame_field_bit(FrameField::Humidity)
+                                                     | get_frame_field_bit(FrameField::HeatIndex)
+                                                     | get_frame_field_bit(FrameField::DewPoint)
+                                                     | get_frame_field_bit(FrameField::AbsoluteHumidity)
+                                                     | get_frame_field_bit(FrameField::VaporPressureDeficit);
+            static constexpr uint32_t BMP280_FIELDS = get_frame_field_bit(FrameField::Pressure)
+                                                      | get_frame_field_bit(FrameField::Bmp280Temperature)
+                                                      | get_frame_field_bit(FrameField::SeaLevelPressure);
+            static constexpr uint32_t AXP192_FIELDS = get_frame_field_bit(FrameField::Count)
+                                                      - get_frame_field_bit(FrameField::AcinVoltage);
+
+            SensorFrame() {}
+
+            /// Get the environment values
+            /// \param return Return the latest EnvirValue
+            const EnvirValue& get_envir_value() const
+            {
+                return envir_value;
+            }
+
+            /// Set the environment values
+            /// \param value The latest EnvirValue
+            void set_envir_value(const EnvirValue& value)
+            {
+                envir_value = value;
+            }
+
+            /// Get the AXP192 values
+            /// \param return Return the latest AxpValue
+            const AxpValue& get_axp_value() const
+            {
+                return axp_value;
+            }
+
+            /// Set the AXP192 values
+            /// \param value The latest AxpValue
+            void set_axp_value(const AxpValue& value)
+            {
+                axp_value = value;
+            }
+
+            /// Is a field valid
+            /// \param field The field
+            /// \param return Return true if the last read of its sensor succeeded
+            bool is_valid(FrameField field) const
+            {
+                return (valid_fields & get_frame_field_bit(field)) != 0;
+            }
+
+            /// Are all of some fields valid
+            /// \param fields The bits of the fields
+            /// \param return Return true if every one of the fields is valid
+            bool are_valid(uint32_t fields) const
+            {
+                return (valid_fields & fields) == fields;
+            }
+
+            /// Set the valid fields
+            /// \param fields The bits of the valid fields
+            void set_valid_fields(uint32_t fields)
+            {
+                valid_fields = fields;
+            }
+
+            /// Get the valid fields
+            /// \param return Return the bits of the valid fields
+            uint32_t get_valid_fields() const
+            {
+                return valid_fields;
+            }
+
+            /// Set the time the frame was published
+            /// \param value The time in microseconds since boot
+            void set_timestamp_us(int64_t value)
+            {
+                timestamp_us = value;
+            }
+
+            /// Get the time the frame was published
+            /// \param return Return the time in microseconds since boot
+            int64_t get_timestamp_us() const
+            {
+                return timestamp_us;
+            }
+
+            /// Set the sequence number, incremented each time a frame is published
+            /// \param value The sequence number
+            void set_sequence(uint32_t value)
+            {
+                sequence = value;
+            }
+
+            /// Get the sequence number
+            /// \param return Return the sequence number
+            uint32_t get_sequence() const
+            {
+                return sequence;
+            }
+
+        private:
+            EnvirValue envir_value{};
+            AxpValue axp_value{};
+            uint32_t valid_fields{ 0 };
+            int64_t timestamp_us{ 0 };
+            uint32_t sequence{ 0 };
+    };
+}
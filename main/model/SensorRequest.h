@@ -0,0 +1,110 @@
+/****************************************************************************************
+ * SensorRequest.h - A request for work sent to the SensorTask
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include "model/Bmp280Profile.h"
+#include "model/HistoryQuery.h"
+
+namespace redstone
+{
+    class SensorRequest
+    {
+        public:
+            enum class Type
+            {
+                Diagnostics,        // log sensor read, scheduler and bus statistics
+                SetBmp280Profile,   // change the BMP280 measurement profile
+                StartTrace,         // start recording the published values into the sensor trace
+                StopTrace,          // stop recording the sensor trace
+                DumpTrace,          // log the recorded sensor trace and clear it
+                Benchmark,          // run the EnvirBenchmark and log the results
+                ExportHistory       // log a downsampled range of the history of a field
+            };
+
+            /// Constructor
+            SensorRequest() {}
+
+            /// Constructor
+            /// \param type The type of request
+            SensorRequest(Type type) : type(type) {}
+
+            /// Constructor
+            /// \param profile The BMP280 profile to change to
+            SensorRequest(Bmp280ProfileId profile) : type(Type::SetBmp280Profile), bmp280_profile(profile) {}
+
+            /// Constructor
+            /// \param field The field to export
+            /// \param span_s The time range, ending now, in seconds
+            /// \param points The number of points
+            /// \param method The downsampling
+            SensorRequest(SeriesField field, uint32_t span_s, uint16_t points, Downsampling method) :
+                    type(Type::ExportHistory),
+                    history_field(field),
+                    history_span_s(span_s),
+                    history_points(points),
+                    history_method(method)
+            {
+            }
+
+            /// Get the request type
+            /// \param return Return the request type
+            Type get_type() const
+            {
+                return type;
+            }
+
+            /// Get the BMP280 profile to change to
+            /// \param return Return the BMP280 profile
+            Bmp280ProfileId get_bmp280_profile() const
+            {
+                return bmp280_profile;
+            }
+
+            /// Get the field to export
+            SeriesField get_history_field() const
+            {
+                return history_field;
+            }
+
+            /// Get the time range to export, ending now, in seconds
+            uint32_t get_history_span_s() const
+            {
+                return history_span_s;
+            }
+
+            /// Get the number of points to export
+            uint16_t get_history_points() const
+            {
+                return history_points;
+            }
+
+            /// Get the downsampling of the export
+            Downsampling get_history_method() const
+            {
+                return history_method;
+            }
+
+        private:
+            Type type{ Type::Diagnostics };
+            Bmp280ProfileId bmp280_profile{ Bmp280ProfileId::UltraLowPowerForced };
+            SeriesField history_field{ SeriesField::Pressure };
+            uint32_t history_span_s{ 0 };
+            uint16_t history_points{ 0 };
+            Downsampling history_method{ Downsampling::Lttb };
+    };
+}
@@ -0,0 +1,145 @@
+/****************************************************************************************
+ * SensorScheduler.cpp - Schedules sensor reads, each sensor with its own period and phase
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/SensorScheduler.h"
+#include <algorithm>
+#include <cstring>
+#include <smooth/core/logging/log.h>
+
+using namespace std::chrono;
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "SensorScheduler";
+
+    // Add a sensor to the schedule
+    void SensorScheduler::add(const char* name, int bus, SamplingSpec sampling, Job job)
+    {
+        // next_due_us is set by the next poll, on the phase grid of the schedule
+        entries.push_back({ name,
+                            bus,
+                            duration_cast<microseconds>(sampling.period).count(),
+                            duration_cast<microseconds>(sampling.phase).count(),
+                            -1,
+                            std::move(job),
+                            {} });
+    }
+
+    // Remove a sensor from the schedule
+    void SensorScheduler::remove(const char* name)
+    {
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [name](const Entry& entry) {
+                                         return strcmp(entry.name, name) == 0;
+                                     }),
+                      entries.end());
+    }
+
+    // Start the jobs that are due, at most one per bus
+    void SensorScheduler::poll(int64_t now_us)
+    {
+        if (start_us < 0)
+        {
+            start_us = now_us;
+        }
+
+        // Place new entries on the first due time of their phase grid that is not in the past
+        for (auto& entry : entries)
+        {
+            if (entry.next_due_us < 0)
+            {
+                int64_t since_phase_us = now_us - start_us - entry.phase_us;
+                int64_t periods = since_phase_us > 0 ? (since_phase_us + entry.period_us - 1) / entry.period_us : 0;
+                entry.next_due_us = start_us + entry.phase_us + periods * entry.period_us;
+            }
+        }
+
+        // Start the most overdue entry first on each bus
+        std::vector<Entry*> due;
+        std::vector<int> busy_buses;
+
+        for (auto& entry : entries)
+        {
+            if (entry.next_due_us <= now_us)
+            {
+                due.push_back(&entry);
+            }
+        }
+
+        std::sort(due.begin(), due.end(), [](const Entry* a, const Entry* b) {
+                      return a->next_due_us < b->next_due_us;
+                  });
+
+        for (auto entry : due)
+        {
+            if (std::find(busy_buses.begin(), busy_buses.end(), entry->bus) == busy_buses.end())
+            {
+                busy_buses.push_back(entry->bus);
+                start(*entry, now_us);
+            }
+        }
+    }
+
+    // Start the job of an entry and update its statistics
+    void SensorScheduler::start(Entry& entry, int64_t now_us)
+    {
+        Statistics& stats = entry.stats;
+        int64_t jitter_us = now_us - entry.next_due_us;
+
+        if (stats.count == 0)
+        {
+            stats.first_us = now_us;
+        }
+
+        stats.count += 1;
+        stats.last_us = now_us;
+        stats.total_jitter_us += jitter_us;
+        stats.max_jitter_us = std::max(stats.max_jitter_us, jitter_us);
+
+        // Keep the schedule on the phase grid, skip the due times that have already passed
+        entry.next_due_us += entry.period_us;
+
+        while (entry.next_due_us <= now_us)
+        {
+            entry.next_due_us += entry.period_us;
+            stats.missed += 1;
+        }
+
+        entry.job();
+    }
+
+    // Print the achieved rate and jitter of each sensor
+    void SensorScheduler::print_statistics() const
+    {
+        for (auto& entry : entries)
+        {
+            const Statistics& stats = entry.stats;
+            int64_t elapsed_us = stats.last_us - stats.first_us;
+
+            if (stats.count > 1 && elapsed_us > 0)
+            {
+                Log::info(TAG, "{}: period={}ms achieved={:.3f}Hz jitter avg={}us max={}us missed={}",
+                          entry.name,
+                          entry.period_us / 1000,
+                          (stats.count - 1) * 1000000.0 / elapsed_us,
+                          stats.total_jitter_us / stats.count,
+                          stats.max_jitter_us,
+                          stats.missed);
+            }
+        }
+    }
+}
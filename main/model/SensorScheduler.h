@@ -0,0 +1,99 @@
+/****************************************************************************************
+ * SensorScheduler.h - Schedules sensor reads, each sensor with its own period and phase
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Every sensor declares a SamplingSpec, a period and a phase offset from the start of
+//  the schedule.  On each poll() the scheduler starts the jobs that are due, but never
+//  more than one job per bus, so reads on the same bus are spread over consecutive polls
+//  instead of piling up in one poll.  Due times are derived from the phase and period so
+//  a late start does not make the following reads drift.  A sensor added after the first
+//  poll starts at its next due time on the same phase grid.
+//
+//  For every sensor the scheduler records the achieved rate and the jitter, the
+//  difference between the time a read was due and the time it was started.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace redstone
+{
+    /// The period and phase offset a sensor is sampled at
+    struct SamplingSpec
+    {
+        std::chrono::milliseconds period;
+        std::chrono::milliseconds phase;
+    };
+
+    class SensorScheduler
+    {
+        public:
+            using Job = std::function<void()>;
+
+            /// The bus of a job that performs no bus transaction
+            static constexpr int NO_BUS = -1;
+
+            /// Add a sensor to the schedule
+            /// \param name The name of the sensor
+            /// \param bus The bus the sensor is on, only one job per bus is started per poll
+            /// \param sampling The period and phase offset of the sensor
+            /// \param job The function that starts the read of the sensor
+            void add(const char* name, int bus, SamplingSpec sampling, Job job);
+
+            /// Remove a sensor from the schedule, must not be called from a job
+            /// \param name The name of the sensor
+            void remove(const char* name);
+
+            /// Start the jobs that are due
+            /// \param now_us The current time in microseconds
+            void poll(int64_t now_us);
+
+            /// Print the achieved rate and jitter of each sensor
+            void print_statistics() const;
+
+        private:
+            struct Statistics
+            {
+                uint32_t count{ 0 };
+                uint32_t missed{ 0 };
+                int64_t first_us{ 0 };
+                int64_t last_us{ 0 };
+                int64_t total_jitter_us{ 0 };
+                int64_t max_jitter_us{ 0 };
+            };
+
+            struct Entry
+            {
+                const char* name;
+                int bus;
+                int64_t period_us;
+                int64_t phase_us;
+                int64_t next_due_us;
+                Job job;
+                Statistics stats;
+            };
+
+            /// Start the job of an entry and update its statistics
+            void start(Entry& entry, int64_t now_us);
+
+            std::vector<Entry> entries{};
+            int64_t start_us{ -1 };
+    };
+}
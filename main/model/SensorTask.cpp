@@ -0,0 +1,434 @@
+/****************************************************************************************
+ * SensorTask.cpp - A dedicated task that acquires the sensor measurements
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/SensorTask.h"
+#include "model/AppEvent.h"
+#include "model/ConflatingMailbox.h"
+#include "model/EnvirBenchmark.h"
+#include "model/SampleStoreBenchmark.h"
+#include "model/TimeSeriesStore.h"
+#include "model/Timeline.h"
+#include <smooth/core/ipc/Publisher.h>
+#include <smooth/core/logging/log.h>
+#include <esp_timer.h>
+#include <thread>
+#include <algorithm>
+#include <string>
+
+using namespace std::chrono;
+using namespace smooth::core;
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "SensorTask";
+
+    // Constructor
+    SensorTask::SensorTask(EnvHat& env_hat, M5StickC& m5stickC) :
+            Task("SensorTask", 6144, 8, milliseconds(10)),
+
+            // The Task Name = "SensorTask"
+            // The stack size is 6144 bytes, the flash writes of the sample log need the extra
+            // The priority is set to 8
+            // The tick interval is 10 milliseconds, the resolution of the scheduler
+
+            env_hat(env_hat),
+            m5stickC(m5stickC),
+            request_queue(RequestQueue::create(2, *this, *this)),
+
+            // Create the request queue so this task can receive SensorRequest events
+            // the queue will hold up to 2 items
+            // the "*this" task is the task to signal when an event is available.
+            // the "*this" is the class instance that will receive the events
+
+            pipeline([]() { return esp_timer_get_time(); },
+                     [](int64_t us) { std::this_thread::sleep_for(microseconds(us)); })
+    {
+    }
+
+    // Task init
+    void SensorTask::init()
+    {
+        Log::info(TAG, "initializing SensorTask");
+        Timeline::instance().name_task("SensorTask");
+
+        // The Envir HAT is brought up by this task so the Application task, display and
+        // buttons never wait on it
+        env_hat.initialize();
+        schedule_sensors();
+
+        if (sample_logger.initialize())
+        {
+            scheduler.add("SampleLog", SensorScheduler::NO_BUS, SampleLogger::SAMPLING, [this]() { log_sample(); });
+        }
+    }
+
+    // Task tick, start the reads that are due and perform them
+    void SensorTask::tick()
+    {
+        scheduler.poll(esp_timer_get_time());
+        process_bus_queues();
+    }
+
+    // Request diagnostics - called from the Application task
+    void SensorTask::request_diagnostics()
+    {
+        push_request(SensorRequest(SensorRequest::Type::Diagnostics));
+    }
+
+    // Request a BMP280 profile change - called from any other task
+    void SensorTask::request_bmp280_profile(Bmp280ProfileId profile)
+    {
+        push_request(SensorRequest(profile));
+    }
+
+    // Request the sensor trace be started, stopped or dumped - called from any other task
+    void SensorTask::request_trace(SensorRequest::Type type)
+    {
+        push_request(SensorRequest(type));
+    }
+
+    // Request the benchmarks be run - called from any other task
+    void SensorTask::request_benchmark()
+    {
+        push_request(SensorRequest(SensorRequest::Type::Benchmark));
+    }
+
+    // Request a range of the history of a field be logged - called from any other task
+    void SensorTask::request_history_export(SeriesField field, uint32_t span_s, uint16_t points, Downsampling method)
+    {
+        push_request(SensorRequest(field, span_s, points, method));
+    }
+
+    // Push a request into the request queue, never blocks
+    void SensorTask::push_request(const SensorRequest& request)
+    {
+        if (!request_queue->push(request))
+        {
+            dropped_requests += 1;
+        }
+    }
+
+    // The SensorRequest event
+    void SensorTask::event(const SensorRequest& event)
+    {
+        if (event.get_type() == SensorRequest::Type::Diagnostics)
+        {
+            m5stickC.measure_axp_read_modes();
+            m5stickC.print_axp_read_statistics();
+            scheduler.print_statistics();
+            pipeline.print_statistics();
+            i2c0_queue.print_statistics();
+            i2c1_queue.print_statistics();
+            env_hat.print_bmp280_profile();
+            TimeSeriesStore::instance().print_statistics();
+            sample_logger.print_statistics();
+            Log::info(TAG, "Dropped requests = {}", dropped_requests.load());
+        }
+        else if (event.get_type() == SensorRequest::Type::SetBmp280Profile)
+        {
+            env_hat.set_bmp280_profile(event.get_bmp280_profile());
+        }
+        else if (event.get_type() == SensorRequest::Type::StartTrace)
+        {
+            Log::info(TAG, "Sensor trace started");
+            tracing = true;
+        }
+        else if (event.get_type() == SensorRequest::Type::StopTrace)
+        {
+            Log::info(TAG, "Sensor trace stopped");
+            tracing = false;
+        }
+        else if (event.get_type() == SensorRequest::Type::DumpTrace)
+        {
+            dump_trace();
+        }
+        else if (event.get_type() == SensorRequest::Type::Benchmark)
+        {
+            EnvirBenchmark::run();
+            SampleStoreBenchmark::run();
+        }
+        else if (event.get_type() == SensorRequest::Type::ExportHistory)
+        {
+            export_history(event);
+        }
+    }
+
+    // Add the sensors to the scheduler
+    void SensorTask::schedule_sensors()
+    {
+        auto envir_completed = [this](const I2cTransactionResult& result) {
+                                   envir_transaction_completed(result, SensorFrame::DHT12_FIELDS);
+                               };
+
+        // without the AXP192 and the BMP280 the DHT12 read ends the cycle
+        cycle_fields = env_hat.is_dht12_initialized() ? SensorFrame::DHT12_FIELDS : 0;
+
+        if (env_hat.is_dht12_initialized())
+        {
+            scheduler.add("DHT12", I2C_NUM_1, EnvHat::DHT12_SAMPLING, [this, envir_completed]() {
+                              reads_started(SensorFrame::DHT12_FIELDS);
+
+                              // a read rejected by the full queue completes as failed
+                              if (!i2c1_queue.enqueue("DHT12", [this]() { return env_hat.read_dht12(); },
+                                                      envir_completed))
+                              {
+                                  envir_completed({ "DHT12", false, 0 });
+                              }
+                          });
+        }
+
+        // The BMP280 bring-up is stepped on i2c1 until it finishes, then the reads are scheduled
+        bmp280_bringup_active = true;
+        scheduler.add("BMP280 bring-up", I2C_NUM_1, EnvHat::BMP280_BRINGUP_SAMPLING, [this]() {
+                          i2c1_queue.enqueue("BMP280 bring-up", [this]() {
+                                                 if (bmp280_bringup_active
+                                                     && env_hat.step_bmp280_bringup(esp_timer_get_time()))
+                                                 {
+                                                     bmp280_bringup_finished();
+                                                 }
+
+                                                 return true;
+                                             }, nullptr);
+                      });
+
+        schedule_axp192_reads();
+    }
+
+    // Add the AXP192 reads to the scheduler
+    void SensorTask::schedule_axp192_reads()
+    {
+        if (m5stickC.is_axp192_initialized())
+        {
+            cycle_fields = SensorFrame::AXP192_FIELDS;
+            scheduler.add("AXP192", I2C_NUM_0, M5StickC::AXP192_SAMPLING, [this]() {
+                              reads_started(SensorFrame::AXP192_FIELDS);
+
+                              // a read rejected by the full queue completes as failed
+                              if (!i2c0_queue.enqueue("AXP192",
+                                                      [this]() { return m5stickC.read_axp(); },
+                                                      [this](const I2cTransactionResult& result) {
+                                                          axp_transaction_completed(result);
+                                                      }))
+                              {
+                                  axp_transaction_completed({ "AXP192", false, 0 });
+                              }
+                          });
+        }
+    }
+
+    // Add the BMP280 and AXP192 sample set to the scheduler
+    void SensorTask::schedule_sample_set()
+    {
+        pipeline.clear();
+        cycle_fields = SensorFrame::BMP280_FIELDS;
+        pipeline.add_split_stage("BMP280", i2c1_queue,
+                                 [this]() { return env_hat.start_measurement(); },
+                                 [this]() { return env_hat.collect_measurement(); },
+                                 [this](const I2cTransactionResult& result) {
+                                     envir_transaction_completed(result, SensorFrame::BMP280_FIELDS);
+                                 });
+
+        if (m5stickC.is_axp192_initialized())
+        {
+            scheduler.remove("AXP192");
+            cycle_fields |= SensorFrame::AXP192_FIELDS;
+            pipeline.add_stage("AXP192", i2c0_queue,
+                               [this]() { return m5stickC.read_axp(); },
+                               [this](const I2cTransactionResult& result) { axp_transaction_completed(result); });
+        }
+
+        scheduler.add("BMP280+AXP192", I2C_NUM_1, EnvHat::BMP280_SAMPLING, [this]() {
+                          reads_started(cycle_fields);
+                          pipeline.run();
+                      });
+    }
+
+    // The BMP280 bring-up has finished, called from the i2c1 queue not from a scheduler job
+    void SensorTask::bmp280_bringup_finished()
+    {
+        bmp280_bringup_active = false;
+        scheduler.remove("BMP280 bring-up");
+
+        if (env_hat.is_bmp280_initialized())
+        {
+            schedule_sample_set();
+        }
+    }
+
+    // Perform the queued transactions, one from each bus in turn
+    void SensorTask::process_bus_queues()
+    {
+        bool busy = true;
+
+        while (busy)
+        {
+            bool i2c0_busy = i2c0_queue.process_next();
+            bool i2c1_busy = i2c1_queue.process_next();
+            busy = i2c0_busy || i2c1_busy;
+        }
+    }
+
+    // Completion of an Envir HAT transaction, the fields of the sensor read are valid if it succeeded
+    void SensorTask::envir_transaction_completed(const I2cTransactionResult& result, uint32_t fields)
+    {
+        log_failed_transaction(result);
+        valid_fields = result.succeeded ? valid_fields | fields : valid_fields & ~fields;
+
+        if (result.succeeded)
+        {
+            env_hat.stamp_measurements();
+            TimeSeriesStore::instance().update(env_hat.get_envir_value());
+
+            if (tracing)
+            {
+                trace.add(env_hat.get_envir_value().get_timestamp_us(), env_hat.get_envir_value());
+            }
+        }
+
+        reads_completed(fields);
+    }
+
+    // Completion of an AXP192 transaction, the AXP192 fields are valid if it succeeded
+    void SensorTask::axp_transaction_completed(const I2cTransactionResult& result)
+    {
+        log_failed_transaction(result);
+        uint32_t fields = SensorFrame::AXP192_FIELDS;
+        valid_fields = result.succeeded ? valid_fields | fields : valid_fields & ~fields;
+
+        if (result.succeeded)
+        {
+            m5stickC.stamp_axp_measurements();
+            TimeSeriesStore::instance().update(m5stickC.get_axp_value());
+
+            if (tracing)
+            {
+                trace.add(m5stickC.get_axp_value().get_timestamp_us(), m5stickC.get_axp_value());
+            }
+        }
+
+        reads_completed(fields);
+    }
+
+    // A job has started reads, every read reports a completion, a rejected one as failed
+    void SensorTask::reads_started(uint32_t fields)
+    {
+        if ((fields & cycle_fields) != 0)
+        {
+            pending_fields = fields & cycle_fields;
+        }
+    }
+
+    // Reads have completed, the frame is published from the completion of the last read of the cycle
+    void SensorTask::reads_completed(uint32_t fields)
+    {
+        if ((pending_fields & fields) != 0)
+        {
+            pending_fields &= ~fields;
+
+            if (pending_fields == 0)
+            {
+                publish_frame();
+            }
+        }
+    }
+
+    // Publish the latest values as one SensorFrame, a frame without a valid field is not published
+    void SensorTask::publish_frame()
+    {
+        if (valid_fields == 0)
+        {
+            return;
+        }
+
+        frame.set_envir_value(env_hat.get_envir_value());
+        frame.set_axp_value(m5stickC.get_axp_value());
+        frame.set_valid_fields(valid_fields);
+        frame.set_sequence(frame.get_sequence() + 1);
+        frame.set_timestamp_us(esp_timer_get_time());
+
+        TimelineScope scope(TimelineKind::Publish, "SensorFrame", frame.get_sequence());
+        Timeline::instance().frame_sent(frame.get_sequence());
+        ConflatingMailbox<SensorFrame>::publish(frame);
+    }
+
+    // Add the latest values of the TimeSeriesStore to the sample log
+    void SensorTask::log_sample()
+    {
+        float values[TimeSeriesStore::FIELD_COUNT];
+        SampleRecord record{};
+        record.time_s = TimeSeriesStore::instance().get_latest(values);
+        std::copy(std::begin(values), std::end(values), record.values.begin());
+
+        sample_logger.add(record, esp_timer_get_time());
+    }
+
+    // Log a range of the history of a field, ending now
+    void SensorTask::export_history(const SensorRequest& request)
+    {
+        const char* name = get_series_field_name(request.get_history_field());
+        auto now_s = static_cast<uint32_t>(esp_timer_get_time() / 1000000);
+        uint32_t from_s = now_s > request.get_history_span_s() ? now_s - request.get_history_span_s() : 0;
+        int64_t start_us = esp_timer_get_time();
+
+        size_t points = history_query.run(request.get_history_field(), from_s, now_s, request.get_history_points(),
+                                          request.get_history_method(), [name](const SeriesSample& sample) {
+                                              Log::info(TAG, "HISTORY {} {} {:.3f}", name, sample.time_s, sample.value);
+                                          });
+
+        Log::info(TAG, "History of {}: {}s {} points from {} {} rows in {}us",
+                  name, now_s - from_s, points, history_query.get_rows_read(),
+                  get_history_source_name(history_query.get_source()), esp_timer_get_time() - start_us);
+    }
+
+    // Log the sensor trace as hex lines and clear it, see host/replay for reading them back
+    void SensorTask::dump_trace()
+    {
+        static const char* HEX_DIGITS = "0123456789abcdef";
+        static constexpr size_t BYTES_PER_LINE = 64;
+        const std::vector<uint8_t>& data = trace.get_data();
+
+        for (size_t start = 0; start < data.size(); start += BYTES_PER_LINE)
+        {
+            std::string line{};
+            size_t end = std::min(start + BYTES_PER_LINE, data.size());
+
+            for (size_t i = start; i < end; i++)
+            {
+                line += HEX_DIGITS[data[i] >> 4];
+                line += HEX_DIGITS[data[i] & 0x0F];
+            }
+
+            Log::info(TAG, "TRACE {}", line);
+        }
+
+        Log::info(TAG, "Sensor trace: records={} bytes={} overflows={}",
+                  trace.get_records(), data.size(), trace.get_overflows());
+        trace.clear();
+    }
+
+    // Log the result of a failed transaction and publish it as a sensor fault
+    void SensorTask::log_failed_transaction(const I2cTransactionResult& result)
+    {
+        if (!result.succeeded)
+        {
+            Log::error(TAG, "{} transaction failed after {} us", result.name, result.duration_us);
+            AppEvent fault(AppEvent::Kind::SensorFault, result.name, esp_timer_get_time());
+            smooth::core::ipc::Publisher<AppEvent>::publish(fault);
+        }
+    }
+}
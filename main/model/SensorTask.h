@@ -0,0 +1,189 @@
+/****************************************************************************************
+ * SensorTask.h - A dedicated task that acquires the sensor measurements
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The sensor reads are performed by this task so a slow or NAKing I2C transaction never
+//  delays the Application task.  Each sensor is read at its own rate by the
+//  SensorScheduler, which is polled on every task tick.  The Application task only
+//  pushes SensorRequest events, it never waits for this task.
+//
+//  Each I2C bus has its own transaction queue; i2c0 (M5StickC internal bus) holds the
+//  AXP192 transactions and i2c1 (Envir HAT bus) holds the DHT12 and BMP280 transactions.
+//  The queues are serviced alternately and every transaction reports its completion.
+//  A successful DHT12, BMP280 or AXP192 read updates the latest values and makes the
+//  fields of its sensor valid, a failed one makes them invalid.  The values are published
+//  as one SensorFrame from the completion of the last read of each cycle, the reads
+//  started by the last job of the cycle, the sample set once the BMP280 is up.
+//
+//  Once the BMP280 is up, the BMP280 and the AXP192 are read together by a SamplePipeline:
+//  the BMP280 conversion is started on i2c1, the AXP192 is read on i2c0 while it runs and
+//  then the BMP280 result is collected.
+//
+//  Every value read is added to the TimeSeriesStore, this task is its only writer.
+//  Every 10 seconds the latest values are added to the SampleLogger, which appends them
+//  to flash; the flash writes block this task, not the display.
+//
+//  An ExportHistory request logs a downsampled range of a field as "HISTORY <field>
+//  <time_s> <value>" lines, read by a HistoryQuery over the TimeSeriesStore and the
+//  sample log.
+//
+//  While tracing, every value read is also recorded into a SensorTrace.  A dump logs
+//  the trace as "TRACE <hex>" lines and clears it, so the trace of a long run can be
+//  captured from the console by dumping it before it fills up.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <memory>  // for shared pointer
+#include <atomic>
+#include <smooth/core/Task.h>
+#include <smooth/core/ipc/IEventListener.h>
+#include <smooth/core/ipc/TaskEventQueue.h>
+#include "model/EnvHat.h"
+#include "model/M5StickC.h"
+#include "model/I2cBusQueue.h"
+#include "model/SensorFrame.h"
+#include "model/SensorRequest.h"
+#include "model/SensorScheduler.h"
+#include "model/SamplePipeline.h"
+#include "model/SensorTrace.h"
+#include "model/SampleLogger.h"
+#include "model/HistoryQuery.h"
+
+namespace redstone
+{
+    class SensorTask : public smooth::core::Task,
+                       public smooth::core::ipc::IEventListener<SensorRequest>
+    {
+        public:
+            /// Constructor
+            /// \param env_hat The Envir HAT, initialized before the task is started
+            /// \param m5stickC The M5StickC, initialized before the task is started
+            SensorTask(EnvHat& env_hat, M5StickC& m5stickC);
+
+            /// Task initialize
+            void init() override;
+
+            /// Task tick
+            void tick() override;
+
+            /// Request the statistics be logged without waiting for it
+            void request_diagnostics();
+
+            /// Request the BMP280 measurement profile be changed without waiting for it
+            /// \param profile The profile to change to
+            void request_bmp280_profile(Bmp280ProfileId profile);
+
+            /// Request the sensor trace be started, stopped or dumped without waiting for it
+            /// \param type StartTrace, StopTrace or DumpTrace
+            void request_trace(SensorRequest::Type type);
+
+            /// Request the benchmarks be run without waiting for them
+            void request_benchmark();
+
+            /// Request a range of the history of a field be logged without waiting for it
+            /// \param field The field
+            /// \param span_s The time range, ending now, in seconds
+            /// \param points The number of points
+            /// \param method The downsampling
+            void request_history_export(SeriesField field, uint32_t span_s, uint16_t points, Downsampling method);
+
+            /// The SensorRequest event that this instance listens for
+            void event(const SensorRequest& event) override;
+
+        private:
+            /// Push a request into the request queue
+            void push_request(const SensorRequest& request);
+
+            /// Add the sensors to the scheduler, each with its declared sampling
+            void schedule_sensors();
+
+            /// Add the AXP192 reads to the scheduler, used when the BMP280 is not present
+            void schedule_axp192_reads();
+
+            /// Add the BMP280 and AXP192 sample set to the scheduler, replacing the AXP192 reads
+            void schedule_sample_set();
+
+            /// The BMP280 bring-up has finished, succeeded or failed
+            void bmp280_bringup_finished();
+
+            /// Perform the queued transactions, alternating between the buses
+            void process_bus_queues();
+
+            /// Completion of an Envir HAT transaction
+            /// \param result The result of the transaction
+            /// \param fields The SensorFrame fields of the sensor read
+            void envir_transaction_completed(const I2cTransactionResult& result, uint32_t fields);
+
+            /// Completion of an AXP192 transaction
+            void axp_transaction_completed(const I2cTransactionResult& result);
+
+            /// A job has started reads, the ones that end the cycle are pending
+            /// \param fields The SensorFrame fields of the sensors read
+            void reads_started(uint32_t fields);
+
+            /// Reads have completed, the frame is published when the last one of the cycle has
+            /// \param fields The SensorFrame fields of the sensors read
+            void reads_completed(uint32_t fields);
+
+            /// Publish the latest values as one SensorFrame
+            void publish_frame();
+
+            /// Add the latest values of the TimeSeriesStore to the sample log
+            void log_sample();
+
+            /// Log a range of the history of a field
+            void export_history(const SensorRequest& request);
+
+            /// Log the sensor trace as hex lines and clear it
+            void dump_trace();
+
+            /// Log the result of a failed transaction
+            void log_failed_transaction(const I2cTransactionResult& result);
+
+            EnvHat& env_hat;
+            M5StickC& m5stickC;
+
+            using RequestQueue = smooth::core::ipc::TaskEventQueue<SensorRequest>;
+            std::shared_ptr<RequestQueue> request_queue;
+
+            I2cBusQueue i2c0_queue{ "i2c0", 8 };
+            I2cBusQueue i2c1_queue{ "i2c1", 8 };
+            SensorScheduler scheduler{};
+            SamplePipeline pipeline;
+            bool bmp280_bringup_active{ false };
+
+            // The reads of each 1 second cycle start at 0 (DHT12), 250 (AXP192) and 500 (BMP280
+            // and AXP192) milliseconds, the frame is published when the reads of cycle_fields,
+            // the last job of the cycle, have completed
+            SensorFrame frame{};
+            uint32_t valid_fields{ 0 };
+            uint32_t cycle_fields{ 0 };
+            uint32_t pending_fields{ 0 };
+
+            // The size of the sensor trace, about 3 minutes at the default sampling
+            static constexpr size_t TRACE_CAPACITY = 8 * 1024;
+            SensorTraceWriter trace{ TRACE_CAPACITY };
+            bool tracing{ false };
+
+            SampleLogger sample_logger{};
+
+            // The sample log can only be read on this task
+            HistoryQuery history_query{ TimeSeriesStore::instance(), &sample_logger };
+
+            std::atomic<uint32_t> dropped_requests{ 0 };
+    };
+}
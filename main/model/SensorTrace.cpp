@@ -0,0 +1,212 @@
+/****************************************************************************************
+ * SensorTrace.cpp - A compact trace of the published EnvirValue and AxpValue measurements
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/SensorTrace.h"
+#include <algorithm>
+#include <cmath>
+
+namespace redstone
+{
+    // Class constants
+    static constexpr size_t ENVIR_PAYLOAD_SIZE = 8;
+    static constexpr size_t AXP_PAYLOAD_SIZE = 24;
+    static constexpr size_t MAX_VARINT_SIZE = 5;        // 32 bits of milliseconds
+    static constexpr float PRESSURE_OFFSET_HPA = 300.0f;
+
+    // Constructor
+    SensorTraceWriter::SensorTraceWriter(size_t capacity) : capacity(capacity)
+    {
+        data.reserve(capacity);
+    }
+
+    // Add an EnvirValue record
+    bool SensorTraceWriter::add(int64_t time_us, const EnvirValue& value)
+    {
+        bool res = add_header(SensorTraceRecordType::Envir, time_us, ENVIR_PAYLOAD_SIZE);
+
+        if (res)
+        {
+            add_int16(value.get_temperature_degree_C(), 100.0f);
+            add_uint16(value.get_relative_humidity(), 100.0f);
+            add_uint16(value.get_pressure_hPa(), 50.0f, PRESSURE_OFFSET_HPA);
+            add_int16(value.get_bmp280_temperature_degree_C(), 100.0f);
+        }
+
+        return res;
+    }
+
+    // Add an AxpValue record
+    bool SensorTraceWriter::add(int64_t time_us, const AxpValue& value)
+    {
+        bool res = add_header(SensorTraceRecordType::Axp, time_us, AXP_PAYLOAD_SIZE);
+
+        if (res)
+        {
+            add_uint16(value.get_acin_voltage(), 1000.0f);
+            add_uint16(value.get_vbus_voltage(), 1000.0f);
+            add_uint16(value.get_battery_voltage(), 1000.0f);
+            add_uint16(value.get_aps_voltage(), 1000.0f);
+            add_uint16(value.get_ts_pin_voltage(), 1000.0f);
+            add_uint16(value.get_acin_current(), 10.0f);
+            add_uint16(value.get_vbus_current(), 10.0f);
+            add_uint16(value.get_battery_charging_current(), 10.0f);
+            add_uint16(value.get_battery_discharging_current(), 10.0f);
+            add_int16(value.get_axp_device_temperature(), 100.0f);
+            add_uint16(value.get_battery_power(), 10.0f);
+            add_int16(value.get_battery_capacity(), 10.0f);
+        }
+
+        return res;
+    }
+
+    // Clear the trace data
+    void SensorTraceWriter::clear()
+    {
+        data.clear();
+    }
+
+    // Add the record header if the whole record fits
+    bool SensorTraceWriter::add_header(SensorTraceRecordType type, int64_t time_us, size_t payload_size)
+    {
+        bool res = data.size() + 1 + MAX_VARINT_SIZE + payload_size <= capacity;
+
+        if (res)
+        {
+            int64_t time_ms = time_us / 1000;
+            uint32_t delta_ms = static_cast<uint32_t>(std::max<int64_t>(time_ms - last_time_ms, 0));
+            last_time_ms = time_ms;
+            records += 1;
+
+            data.push_back(static_cast<uint8_t>(type));
+
+            while (delta_ms >= 0x80)
+            {
+                data.push_back(static_cast<uint8_t>(delta_ms | 0x80));
+                delta_ms >>= 7;
+            }
+
+            data.push_back(static_cast<uint8_t>(delta_ms));
+        }
+        else
+        {
+            overflows += 1;
+        }
+
+        return res;
+    }
+
+    // Add a signed 16 bit value
+    void SensorTraceWriter::add_int16(float value, float scale)
+    {
+        float scaled = std::round(value * scale);
+        auto raw = static_cast<int16_t>(std::min(std::max(scaled, -32768.0f), 32767.0f));
+        uint16_t bits = static_cast<uint16_t>(raw);
+        data.push_back(static_cast<uint8_t>(bits & 0xFF));
+        data.push_back(static_cast<uint8_t>(bits >> 8));
+    }
+
+    // Add an unsigned 16 bit value
+    void SensorTraceWriter::add_uint16(float value, float scale, float offset)
+    {
+        float scaled = std::round((value - offset) * scale);
+        auto raw = static_cast<uint16_t>(std::min(std::max(scaled, 0.0f), 65535.0f));
+        data.push_back(static_cast<uint8_t>(raw & 0xFF));
+        data.push_back(static_cast<uint8_t>(raw >> 8));
+    }
+
+    // Constructor
+    SensorTraceReader::SensorTraceReader(const uint8_t* data, size_t size) : data(data), size(size)
+    {
+    }
+
+    // Read the next record
+    bool SensorTraceReader::next(SensorTraceRecord& record)
+    {
+        bool res = position < size;
+
+        if (res)
+        {
+            auto type = static_cast<SensorTraceRecordType>(data[position++]);
+            uint32_t delta_ms = 0;
+            int shift = 0;
+            bool more = true;
+
+            while (more && position < size && shift < 32)
+            {
+                uint8_t byte = data[position++];
+                delta_ms |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                shift += 7;
+                more = (byte & 0x80) != 0;
+            }
+
+            size_t payload_size = type == SensorTraceRecordType::Envir ? ENVIR_PAYLOAD_SIZE
+                                  : type == SensorTraceRecordType::Axp ? AXP_PAYLOAD_SIZE : 0;
+
+            res = !more && payload_size > 0 && position + payload_size <= size;
+
+            if (res)
+            {
+                time_ms += delta_ms;
+                record.type = type;
+                record.time_ms = time_ms;
+
+                if (type == SensorTraceRecordType::Envir)
+                {
+                    record.envir_value.set_temperture_degree_C(read_int16(100.0f));
+                    record.envir_value.set_relative_humidity(read_uint16(100.0f));
+                    record.envir_value.set_pressure_hPa(read_uint16(50.0f, PRESSURE_OFFSET_HPA));
+                    record.envir_value.set_bmp280_temperture_degree_C(read_int16(100.0f));
+                    record.envir_value.compute_derived_values();
+                }
+                else
+                {
+                    record.axp_value.set_acin_voltage(read_uint16(1000.0f));
+                    record.axp_value.set_vbus_voltage(read_uint16(1000.0f));
+                    record.axp_value.set_battery_voltage(read_uint16(1000.0f));
+                    record.axp_value.set_aps_voltage(read_uint16(1000.0f));
+                    record.axp_value.set_ts_pin_voltage(read_uint16(1000.0f));
+                    record.axp_value.set_acin_current(read_uint16(10.0f));
+                    record.axp_value.set_vbus_current(read_uint16(10.0f));
+                    record.axp_value.set_battery_charging_current(read_uint16(10.0f));
+                    record.axp_value.set_battery_discharging_current(read_uint16(10.0f));
+                    record.axp_value.set_axp_device_temperature(read_int16(100.0f));
+                    record.axp_value.set_battery_power(read_uint16(10.0f));
+                    record.axp_value.set_battery_capacity(read_int16(10.0f));
+                }
+            }
+        }
+
+        return res;
+    }
+
+    // Read a signed 16 bit value
+    float SensorTraceReader::read_int16(float scale)
+    {
+        uint16_t bits = static_cast<uint16_t>(data[position] | (data[position + 1] << 8));
+        position += 2;
+
+        return static_cast<int16_t>(bits) / scale;
+    }
+
+    // Read an unsigned 16 bit value
+    float SensorTraceReader::read_uint16(float scale, float offset)
+    {
+        uint16_t raw = static_cast<uint16_t>(data[position] | (data[position + 1] << 8));
+        position += 2;
+
+        return raw / scale + offset;
+    }
+}
@@ -0,0 +1,145 @@
+/****************************************************************************************
+ * SensorTrace.h - A compact trace of the published EnvirValue and AxpValue measurements
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  A trace is a sequence of records, one for each published value:
+//
+//      byte        record type, 1 = EnvirValue, 2 = AxpValue
+//      varint      milliseconds since the previous record, 7 bits per byte, low first
+//      payload     the measurements as 16 bit little endian fixed point numbers
+//
+//  EnvirValue payload, 8 bytes:
+//      int16 temperature 0.01C, uint16 humidity 0.01%RH,
+//      uint16 pressure above 300hPa 0.02hPa, int16 BMP280 temperature 0.01C
+//
+//  AxpValue payload, 24 bytes:
+//      uint16 acin, vbus, battery, aps and ts pin voltages 1mV,
+//      uint16 acin, vbus, battery charging and discharging currents 0.1mA,
+//      int16 device temperature 0.01C, uint16 battery power 0.1mW, int16 capacity 0.1mAh
+//
+//  A record is usually 11 or 27 bytes, about 150kB an hour at the default sampling.
+//  Values out of range are clamped.  The writer keeps the time of the last record when
+//  its data is cleared, so the data of consecutive clears can be concatenated into one
+//  trace.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "model/EnvirValue.h"
+#include "model/AxpValue.h"
+
+namespace redstone
+{
+    enum class SensorTraceRecordType : uint8_t
+    {
+        Envir = 1,
+        Axp = 2
+    };
+
+    /// A record read from a trace
+    struct SensorTraceRecord
+    {
+        SensorTraceRecordType type{ SensorTraceRecordType::Envir };
+        int64_t time_ms{ 0 };           // time since the start of the trace
+        EnvirValue envir_value{};       // valid when type is Envir
+        AxpValue axp_value{};           // valid when type is Axp
+    };
+
+    class SensorTraceWriter
+    {
+        public:
+            /// Constructor
+            /// \param capacity The maximum size of the trace data in bytes
+            explicit SensorTraceWriter(size_t capacity);
+
+            /// Add an EnvirValue record
+            /// \param time_us The time of the value in microseconds
+            /// \param value The value
+            /// \return true on success, false if the trace is full
+            bool add(int64_t time_us, const EnvirValue& value);
+
+            /// Add an AxpValue record
+            /// \param time_us The time of the value in microseconds
+            /// \param value The value
+            /// \return true on success, false if the trace is full
+            bool add(int64_t time_us, const AxpValue& value);
+
+            /// Clear the trace data, the time of the last record is kept
+            void clear();
+
+            /// Get the trace data
+            const std::vector<uint8_t>& get_data() const
+            {
+                return data;
+            }
+
+            /// Get the number of records added
+            uint32_t get_records() const
+            {
+                return records;
+            }
+
+            /// Get the number of records not added because the trace was full
+            uint32_t get_overflows() const
+            {
+                return overflows;
+            }
+
+        private:
+            /// Add the record header if the record fits
+            /// \param type The record type
+            /// \param time_us The time of the record in microseconds
+            /// \param payload_size The size of the payload
+            bool add_header(SensorTraceRecordType type, int64_t time_us, size_t payload_size);
+
+            /// Add a 16 bit value, scaled and clamped
+            void add_int16(float value, float scale);
+            void add_uint16(float value, float scale, float offset = 0.0f);
+
+            size_t capacity;
+            std::vector<uint8_t> data{};
+            int64_t last_time_ms{ 0 };
+            uint32_t records{ 0 };
+            uint32_t overflows{ 0 };
+    };
+
+    class SensorTraceReader
+    {
+        public:
+            /// Constructor
+            /// \param data The trace data, must outlive the reader
+            /// \param size The size of the trace data
+            SensorTraceReader(const uint8_t* data, size_t size);
+
+            /// Read the next record
+            /// \param record The record read
+            /// \return true on success, false at the end of the trace or if the data is corrupt
+            bool next(SensorTraceRecord& record);
+
+        private:
+            /// Read a 16 bit value and scale it
+            float read_int16(float scale);
+            float read_uint16(float scale, float offset = 0.0f);
+
+            const uint8_t* data;
+            size_t size;
+            size_t position{ 0 };
+            int64_t time_ms{ 0 };
+    };
+}
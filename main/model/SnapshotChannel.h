@@ -0,0 +1,112 @@
+/****************************************************************************************
+ * SnapshotChannel.h - The latest published value of a type, shared by all its readers
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  One writer, the task that publishes T, and any number of readers on any task share
+//  two copies of the value.  Write k goes into buffer k % 2, so a write never touches
+//  the buffer holding the latest value, and a sequence lock tells a reader whether the
+//  copy it took was overwritten meanwhile:
+//
+//      sequence    2k when k writes are done, 2k + 1 while write k + 1 is in progress
+//
+//  A reader copies buffer k % 2 of the sequence it loaded and the copy is consistent as
+//  long as write k + 2, the next write into that buffer, has not started, the sequence
+//  is still below 2k + 3.  Otherwise it tries again.  Neither side takes a lock or
+//  blocks, the writer never waits for a reader, and there is no memory per reader.
+//
+//  The copy is a memcpy that may race with the writer, so T must be trivially copyable.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace redstone
+{
+    template<typename T>
+    class SnapshotChannel
+    {
+        public:
+            static_assert(std::is_trivially_copyable<T>::value, "A snapshot is copied with memcpy");
+
+            /// Get the channel of T
+            static SnapshotChannel<T>& instance()
+            {
+                static SnapshotChannel<T> channel;
+
+                return channel;
+            }
+
+            /// Write the latest value - called only by the task that publishes T
+            /// \param item The value
+            void write(const T& item)
+            {
+                uint32_t start = sequence.load(std::memory_order_relaxed);
+                uint32_t writes = start / 2 + 1;
+
+                sequence.store(start + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                std::memcpy(&buffers[writes % 2], &item, sizeof(T));
+                sequence.store(start + 2, std::memory_order_release);
+            }
+
+            /// Read the latest value - called from any task
+            /// \param item Is set to the latest value, unchanged if none was written
+            /// \param return Return the number of writes of the value read, 0 if none
+            uint32_t read(T& item) const
+            {
+                T copy;
+
+                while (true)
+                {
+                    uint32_t start = sequence.load(std::memory_order_acquire);
+                    uint32_t writes = start / 2;
+
+                    if (writes == 0)
+                    {
+                        return 0;
+                    }
+
+                    std::memcpy(&copy, &buffers[writes % 2], sizeof(T));
+                    std::atomic_thread_fence(std::memory_order_acquire);
+
+                    if (sequence.load(std::memory_order_relaxed) < writes * 2 + 3)
+                    {
+                        item = copy;
+
+                        return writes;
+                    }
+                }
+            }
+
+            /// Get the number of writes
+            uint32_t get_writes() const
+            {
+                return sequence.load(std::memory_order_acquire) / 2;
+            }
+
+        private:
+            /// Constructor
+            SnapshotChannel() = default;
+
+            std::atomic<uint32_t> sequence{ 0 };
+            std::array<T, 2> buffers{};
+    };
+}
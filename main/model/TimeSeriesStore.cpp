@@ -0,0 +1,348 @@
+/****************************************************************************************
+ * TimeSeriesStore.cpp - The recent history of the sensor values at three resolutions
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/TimeSeriesStore.h"
+#include <cmath>
+#include <limits>
+#include <smooth/core/logging/log.h>
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "TimeSeriesStore";
+    static constexpr uint32_t SECONDS_PER_MINUTE = 60;
+    static constexpr uint32_t SECONDS_PER_HOUR = 3600;
+
+    // Get the name of a series field
+    const char* get_series_field_name(SeriesField field)
+    {
+        static const char* names[] = { "temperature", "humidity", "pressure", "bmp280_temperature",
+                                       "battery_voltage", "battery_current", "vbus_voltage", "axp_temperature" };
+
+        return field < SeriesField::Count ? names[static_cast<size_t>(field)] : "unknown";
+    }
+
+    // Perform a read, again if the writer changed the rings while it was reading
+    template<typename Read>
+    static size_t read_consistent(const std::atomic<uint32_t>& sequence, Read read)
+    {
+        size_t count = 0;
+        uint32_t before;
+        uint32_t after;
+
+        do
+        {
+            before = sequence.load(std::memory_order_acquire);
+            count = (before & 1) == 0 ? read() : 0;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence.load(std::memory_order_relaxed);
+        } while ((before & 1) != 0 || before != after);
+
+        return count;
+    }
+
+    // Get the store
+    TimeSeriesStore& TimeSeriesStore::instance()
+    {
+        static TimeSeriesStore store;
+
+        return store;
+    }
+
+    // Constructor
+    TimeSeriesStore::TimeSeriesStore()
+    {
+        for (auto& value : latest)
+        {
+            value = std::numeric_limits<float>::quiet_NaN();
+        }
+    }
+
+    // Update the environment fields
+    void TimeSeriesStore::update(const EnvirValue& value)
+    {
+        advance(value.get_timestamp_us());
+        set(SeriesField::Temperature, value.get_temperature_degree_C());
+        set(SeriesField::Humidity, value.get_relative_humidity());
+        set(SeriesField::Pressure, value.get_pressure_hPa());
+        set(SeriesField::Bmp280Temperature, value.get_bmp280_temperature_degree_C());
+    }
+
+    // Update the AXP192 fields
+    void TimeSeriesStore::update(const AxpValue& value)
+    {
+        advance(value.get_timestamp_us());
+        set(SeriesField::BatteryVoltage, value.get_battery_voltage());
+        set(SeriesField::BatteryCurrent,
+            value.get_battery_charging_current() - value.get_battery_discharging_current());
+        set(SeriesField::VbusVoltage, value.get_vbus_voltage());
+        set(SeriesField::AxpTemperature, value.get_axp_device_temperature());
+    }
+
+    // Commit the held values if the time is in a later second
+    void TimeSeriesStore::advance(int64_t time_us)
+    {
+        auto time_s = static_cast<uint32_t>(time_us / 1000000);
+
+        if (has_latest && time_s > latest_s)
+        {
+            commit_row(latest_s);
+        }
+
+        if (!has_latest || time_s > latest_s)
+        {
+            latest_s = time_s;
+            has_latest = true;
+        }
+    }
+
+    // Commit the held values as a raw row and add them to the rollups
+    void TimeSeriesStore::commit_row(uint32_t time_s)
+    {
+        uint32_t start = sequence.load(std::memory_order_relaxed);
+        sequence.store(start + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        raw_time_s[raw_head] = time_s;
+
+        for (size_t field = 0; field < FIELD_COUNT; field++)
+        {
+            raw_values[field][raw_head] = latest[field];
+        }
+
+        raw_head = (raw_head + 1) % RAW_CAPACITY;
+        raw_size = raw_size < RAW_CAPACITY ? raw_size + 1 : RAW_CAPACITY;
+
+        add_to_rollup(open_minute, minutes, SECONDS_PER_MINUTE, time_s);
+        add_to_rollup(open_hour, hours, SECONDS_PER_HOUR, time_s);
+
+        sequence.store(start + 2, std::memory_order_release);
+    }
+
+    // Add the held values to an open rollup
+    template<size_t Capacity>
+    void TimeSeriesStore::add_to_rollup(OpenRollup& open, RollupRing<Capacity>& ring, uint32_t period_s, uint32_t time_s)
+    {
+        uint32_t period_start_s = time_s - time_s % period_s;
+
+        if (open.open && open.time_s != period_start_s)
+        {
+            ring.time_s[ring.head] = open.time_s;
+
+            for (size_t field = 0; field < FIELD_COUNT; field++)
+            {
+                ring.min[field][ring.head] = open.min[field];
+                ring.max[field][ring.head] = open.max[field];
+                ring.sum[field][ring.head] = open.sum[field];
+                ring.count[field][ring.head] = open.count[field];
+            }
+
+            ring.head = (ring.head + 1) % Capacity;
+            ring.size = ring.size < Capacity ? ring.size + 1 : Capacity;
+            open.open = false;
+        }
+
+        if (!open.open)
+        {
+            open.time_s = period_start_s;
+            open.open = true;
+
+            for (size_t field = 0; field < FIELD_COUNT; field++)
+            {
+                open.min[field] = std::numeric_limits<float>::max();
+                open.max[field] = std::numeric_limits<float>::lowest();
+                open.sum[field] = 0;
+                open.count[field] = 0;
+            }
+        }
+
+        for (size_t field = 0; field < FIELD_COUNT; field++)
+        {
+            float value = latest[field];
+
+            if (!std::isnan(value))
+            {
+                open.min[field] = value < open.min[field] ? value : open.min[field];
+                open.max[field] = value > open.max[field] ? value : open.max[field];
+                open.sum[field] += value;
+                open.count[field] += 1;
+            }
+        }
+    }
+
+    // Read the raw samples of a field
+    size_t TimeSeriesStore::read_raw(SeriesField field, uint32_t from_s, uint32_t to_s,
+                                     SeriesSample* samples, size_t max_samples) const
+    {
+        auto f = static_cast<size_t>(field);
+
+        return read_consistent(sequence, [&]() {
+            size_t oldest = (raw_head + RAW_CAPACITY - raw_size) % RAW_CAPACITY;
+            size_t matching = 0;
+            size_t count = 0;
+
+            for (size_t i = 0; i < raw_size; i++)
+            {
+                uint32_t time_s = raw_time_s[(oldest + i) % RAW_CAPACITY];
+                matching += time_s >= from_s && time_s <= to_s ? 1 : 0;
+            }
+
+            // only the newest fit
+            size_t skip = matching > max_samples ? matching - max_samples : 0;
+
+            for (size_t i = 0; i < raw_size && count < max_samples; i++)
+            {
+                size_t index = (oldest + i) % RAW_CAPACITY;
+                uint32_t time_s = raw_time_s[index];
+
+                if (time_s >= from_s && time_s <= to_s)
+                {
+                    if (skip > 0)
+                    {
+                        skip--;
+                    }
+                    else
+                    {
+                        samples[count++] = SeriesSample{ time_s, raw_values[f][index] };
+                    }
+                }
+            }
+
+            return count;
+        });
+    }
+
+    // Read the minute or hour rollups of a field
+    size_t TimeSeriesStore::read_rollups(SeriesResolution resolution, SeriesField field, uint32_t from_s, uint32_t to_s,
+                                         SeriesRollup* rollups, size_t max_rollups) const
+    {
+        auto f = static_cast<size_t>(field);
+
+        return resolution == SeriesResolution::Hour
+               ? read_ring(hours, f, from_s, to_s, rollups, max_rollups)
+               : read_ring(minutes, f, from_s, to_s, rollups, max_rollups);
+    }
+
+    // Read the rollups of a ring
+    template<size_t Capacity>
+    size_t TimeSeriesStore::read_ring(const RollupRing<Capacity>& ring, size_t field, uint32_t from_s, uint32_t to_s,
+                                      SeriesRollup* rollups, size_t max_rollups) const
+    {
+        return read_consistent(sequence, [&]() {
+            size_t oldest = (ring.head + Capacity - ring.size) % Capacity;
+            size_t matching = 0;
+            size_t count = 0;
+
+            for (size_t i = 0; i < ring.size; i++)
+            {
+                uint32_t time_s = ring.time_s[(oldest + i) % Capacity];
+                matching += time_s >= from_s && time_s <= to_s ? 1 : 0;
+            }
+
+            size_t skip = matching > max_rollups ? matching - max_rollups : 0;
+
+            for (size_t i = 0; i < ring.size && count < max_rollups; i++)
+            {
+                size_t index = (oldest + i) % Capacity;
+                uint32_t time_s = ring.time_s[index];
+
+                if (time_s >= from_s && time_s <= to_s)
+                {
+                    if (skip > 0)
+                    {
+                        skip--;
+                    }
+                    else
+                    {
+                        uint16_t n = ring.count[field][index];
+                        float nan = std::numeric_limits<float>::quiet_NaN();
+
+                        rollups[count++] = SeriesRollup{ time_s,
+                                                         n > 0 ? ring.min[field][index] : nan,
+                                                         n > 0 ? ring.max[field][index] : nan,
+                                                         n > 0 ? ring.sum[field][index] / n : nan,
+                                                         n };
+                    }
+                }
+            }
+
+            return count;
+        });
+    }
+
+    // Get the latest value of every field, the writer owns them so no retry is needed
+    uint32_t TimeSeriesStore::get_latest(float (&values)[FIELD_COUNT]) const
+    {
+        for (size_t field = 0; field < FIELD_COUNT; field++)
+        {
+            values[field] = latest[field];
+        }
+
+        return latest_s;
+    }
+
+    // Get the time span held at a resolution
+    bool TimeSeriesStore::get_span(SeriesResolution resolution, uint32_t& oldest_s, uint32_t& newest_s) const
+    {
+        size_t rows = read_consistent(sequence, [&]() {
+            size_t size = 0;
+
+            if (resolution == SeriesResolution::Raw && raw_size > 0)
+            {
+                size = raw_size;
+                oldest_s = raw_time_s[(raw_head + RAW_CAPACITY - raw_size) % RAW_CAPACITY];
+                newest_s = raw_time_s[(raw_head + RAW_CAPACITY - 1) % RAW_CAPACITY];
+            }
+            else if (resolution == SeriesResolution::Minute && minutes.size > 0)
+            {
+                size = minutes.size;
+                oldest_s = minutes.time_s[(minutes.head + MINUTE_CAPACITY - minutes.size) % MINUTE_CAPACITY];
+                newest_s = minutes.time_s[(minutes.head + MINUTE_CAPACITY - 1) % MINUTE_CAPACITY];
+            }
+            else if (resolution == SeriesResolution::Hour && hours.size > 0)
+            {
+                size = hours.size;
+                oldest_s = hours.time_s[(hours.head + HOUR_CAPACITY - hours.size) % HOUR_CAPACITY];
+                newest_s = hours.time_s[(hours.head + HOUR_CAPACITY - 1) % HOUR_CAPACITY];
+            }
+
+            return size;
+        });
+
+        return rows > 0;
+    }
+
+    // Log the number of rows at each resolution and the memory used
+    void TimeSeriesStore::print_statistics() const
+    {
+        size_t raw = 0;
+        size_t minute = 0;
+        size_t hour = 0;
+
+        read_consistent(sequence, [&]() {
+            raw = raw_size;
+            minute = minutes.size;
+            hour = hours.size;
+
+            return raw;
+        });
+
+        Log::info(TAG, "rows: raw={}/{} minute={}/{} hour={}/{}, {} bytes",
+                  raw, RAW_CAPACITY, minute, MINUTE_CAPACITY, hour, HOUR_CAPACITY, sizeof(TimeSeriesStore));
+    }
+}
@@ -0,0 +1,208 @@
+/****************************************************************************************
+ * TimeSeriesStore.h - The recent history of the sensor values at three resolutions
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  The latest value of every series field is held and once a second, when the values of
+//  a later second arrive, they are committed as a raw row.  Every raw row is also added
+//  to the open minute and hour rollups, which are committed when a later minute or hour
+//  starts.  A field without a value yet is NaN and is left out of the rollups.
+//
+//  Each resolution is a ring of fixed capacity, stored as a struct of arrays: the times
+//  and then each field in its own array, so reading one field over a time range walks
+//  contiguous memory.  All storage is static, about 30kB.
+//
+//  There is a single writer, the SensorTask.  Readers on any task are never blocked: the
+//  writer makes a sequence number odd while it changes the rings and readers retry a
+//  read that overlapped a change.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "model/EnvirValue.h"
+#include "model/AxpValue.h"
+
+namespace redstone
+{
+    /// The sensor values kept in the history
+    enum class SeriesField : uint8_t
+    {
+        Temperature,            // DHT12 temperature, C
+        Humidity,               // DHT12 relative humidity, %RH
+        Pressure,               // BMP280 pressure, hPa
+        Bmp280Temperature,      // BMP280 temperature, C
+        BatteryVoltage,         // V
+        BatteryCurrent,         // charging minus discharging current, mA
+        VbusVoltage,            // V
+        AxpTemperature,         // AXP192 device temperature, C
+        Count
+    };
+
+    /// Get the name of a series field
+    /// \param field The field
+    /// \param return Return the name of the field
+    const char* get_series_field_name(SeriesField field);
+
+    /// The resolutions of the history
+    enum class SeriesResolution : uint8_t
+    {
+        Raw,                    // one row per second
+        Minute,
+        Hour
+    };
+
+    /// A raw sample of a field
+    struct SeriesSample
+    {
+        uint32_t time_s;
+        float value;
+    };
+
+    /// A rollup of a field over a minute or an hour
+    struct SeriesRollup
+    {
+        uint32_t time_s;        // the start of the minute or hour
+        float min;
+        float max;
+        float mean;
+        uint16_t count;         // the number of raw rows with a value
+    };
+
+    class TimeSeriesStore
+    {
+        public:
+            static constexpr size_t FIELD_COUNT = static_cast<size_t>(SeriesField::Count);
+            static constexpr size_t RAW_CAPACITY = 300;         // 5 minutes
+            static constexpr size_t MINUTE_CAPACITY = 120;      // 2 hours
+            static constexpr size_t HOUR_CAPACITY = 48;         // 2 days
+
+            /// Get the store
+            static TimeSeriesStore& instance();
+
+            /// Update the environment fields, called by the writer only
+            /// \param value The published value, its timestamp is the time of the values
+            void update(const EnvirValue& value);
+
+            /// Update the AXP192 fields, called by the writer only
+            /// \param value The published value, its timestamp is the time of the values
+            void update(const AxpValue& value);
+
+            /// Read the raw samples of a field
+            /// \param field The field
+            /// \param from_s The start of the time range in seconds since boot
+            /// \param to_s The end of the time range, inclusive
+            /// \param samples The samples read, oldest first
+            /// \param max_samples The size of samples, the newest are read if there are more
+            /// \return The number of samples read
+            size_t read_raw(SeriesField field, uint32_t from_s, uint32_t to_s,
+                            SeriesSample* samples, size_t max_samples) const;
+
+            /// Read the minute or hour rollups of a field
+            /// \param resolution Minute or Hour
+            /// \param field The field
+            /// \param from_s The start of the time range in seconds since boot
+            /// \param to_s The end of the time range, inclusive
+            /// \param rollups The rollups read, oldest first
+            /// \param max_rollups The size of rollups, the newest are read if there are more
+            /// \return The number of rollups read
+            size_t read_rollups(SeriesResolution resolution, SeriesField field, uint32_t from_s, uint32_t to_s,
+                                SeriesRollup* rollups, size_t max_rollups) const;
+
+            /// Get the latest value of every field, called by the writer only
+            /// \param values The values indexed by SeriesField, NaN if no value yet
+            /// \return The time of the values in seconds since boot
+            uint32_t get_latest(float (&values)[FIELD_COUNT]) const;
+
+            /// Get the time span held at a resolution
+            /// \param resolution The resolution
+            /// \param oldest_s The time of the oldest row
+            /// \param newest_s The time of the newest row
+            /// \return false if there are no rows at the resolution
+            bool get_span(SeriesResolution resolution, uint32_t& oldest_s, uint32_t& newest_s) const;
+
+            /// Log the number of rows at each resolution and the memory used
+            void print_statistics() const;
+
+        private:
+            /// Constructor
+            TimeSeriesStore();
+
+            /// A ring of rollups
+            template<size_t Capacity>
+            struct RollupRing
+            {
+                uint32_t time_s[Capacity];
+                float min[FIELD_COUNT][Capacity];
+                float max[FIELD_COUNT][Capacity];
+                float sum[FIELD_COUNT][Capacity];
+                uint16_t count[FIELD_COUNT][Capacity];
+                size_t head{ 0 };           // the next row written
+                size_t size{ 0 };
+            };
+
+            /// The rollup being accumulated
+            struct OpenRollup
+            {
+                uint32_t time_s;
+                float min[FIELD_COUNT];
+                float max[FIELD_COUNT];
+                float sum[FIELD_COUNT];
+                uint16_t count[FIELD_COUNT];
+                bool open{ false };
+            };
+
+            /// Set a held field value
+            void set(SeriesField field, float value)
+            {
+                latest[static_cast<size_t>(field)] = value;
+            }
+
+            /// Commit the held values if the time is in a later second
+            /// \param time_us The time of the values being updated
+            void advance(int64_t time_us);
+
+            /// Commit the held values as a raw row and add them to the rollups
+            void commit_row(uint32_t time_s);
+
+            /// Add the held values to an open rollup, committing it first if a new period started
+            template<size_t Capacity>
+            void add_to_rollup(OpenRollup& open, RollupRing<Capacity>& ring, uint32_t period_s, uint32_t time_s);
+
+            /// Read the rollups of a ring
+            template<size_t Capacity>
+            size_t read_ring(const RollupRing<Capacity>& ring, size_t field, uint32_t from_s, uint32_t to_s,
+                             SeriesRollup* rollups, size_t max_rollups) const;
+
+            // The writer makes it odd while changing the rings
+            std::atomic<uint32_t> sequence{ 0 };
+
+            float latest[FIELD_COUNT];
+            uint32_t latest_s{ 0 };
+            bool has_latest{ false };
+
+            uint32_t raw_time_s[RAW_CAPACITY];
+            float raw_values[FIELD_COUNT][RAW_CAPACITY];
+            size_t raw_head{ 0 };
+            size_t raw_size{ 0 };
+
+            OpenRollup open_minute{};
+            OpenRollup open_hour{};
+            RollupRing<MINUTE_CAPACITY> minutes{};
+            RollupRing<HOUR_CAPACITY> hours{};
+    };
+}
@@ -0,0 +1,237 @@
+/****************************************************************************************
+ * Timeline.cpp - Records timestamped events of the tasks for the Chrome trace viewer
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+#include "model/Timeline.h"
+#include <algorithm>
+#include <cstdio>
+#include <esp_timer.h>
+#include <smooth/core/logging/log.h>
+
+using namespace smooth::core::logging;
+
+namespace redstone
+{
+    // Class constants
+    static const char* TAG = "Timeline";
+    static const char* KIND_NAMES[] = { "read", "publish", "deliver", "label", "render", "flush", "display" };
+
+    // Get the timeline
+    Timeline& Timeline::instance()
+    {
+        static Timeline timeline;
+
+        return timeline;
+    }
+
+    // Allocate the rings and start recording
+    void Timeline::start()
+    {
+        std::lock_guard<std::mutex> lock(dump_guard);
+
+        if (!rings)
+        {
+            rings.reset(new Ring[MAX_TASKS]);
+            Log::info(TAG, "Recording {} events of up to {} tasks, {} bytes", RING_SIZE, MAX_TASKS,
+                      MAX_TASKS * sizeof(Ring));
+        }
+
+        recording.store(true, std::memory_order_release);
+    }
+
+    // Name the track of the calling task
+    void Timeline::name_task(const char* name)
+    {
+        size_t ring = get_task_ring();
+
+        if (ring < MAX_TASKS)
+        {
+            task_names[ring].store(name);
+        }
+    }
+
+    // Record an event in the ring of the calling task, only this task writes to it
+    void Timeline::record(TimelineKind kind, const char* name, uint32_t sequence, char phase)
+    {
+        if (!is_recording())
+        {
+            return;
+        }
+
+        size_t index = get_task_ring();
+
+        if (index == MAX_TASKS)
+        {
+            lost.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        Ring& ring = rings[index];
+        uint32_t head = ring.head.load(std::memory_order_relaxed);
+
+        // the event RING_SIZE before is overwritten, a reader copying it drops it
+        ring.claimed.store(head + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        ring.events[head % RING_SIZE] = Event{ esp_timer_get_time(), name, sequence, kind, phase };
+        ring.head.store(head + 1, std::memory_order_release);
+    }
+
+    // Get the ring of the calling task, taken the first time the task records
+    size_t Timeline::get_task_ring()
+    {
+        thread_local size_t ring = MAX_TASKS + 1;
+
+        if (ring > MAX_TASKS)
+        {
+            ring = std::min(task_count.fetch_add(1), MAX_TASKS);
+        }
+
+        return ring;
+    }
+
+    // Log the events recorded since the last dump as TIMELINE lines
+    void Timeline::dump()
+    {
+        std::vector<std::string> events;
+        collect(true, events);
+
+        for (const auto& event : events)
+        {
+            Log::info(TAG, "TIMELINE {}", event);
+        }
+
+        uint32_t lost_events = lost.exchange(0);
+
+        if (lost_events > 0)
+        {
+            Log::warning(TAG, "{} events of tasks without a ring were not recorded", lost_events);
+        }
+    }
+
+    // Write every event still in the rings as a Chrome trace file
+    void Timeline::write(std::ostream& out)
+    {
+        std::vector<std::string> events;
+        collect(false, events);
+        write_document(events, out);
+    }
+
+    // Write trace events as a Chrome trace file, in the JSON object format
+    void Timeline::write_document(const std::vector<std::string>& events, std::ostream& out)
+    {
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            out << events[i] << (i + 1 < events.size() ? ",\n" : "\n");
+        }
+
+        out << "]}\n";
+    }
+
+    // Copy the events of the rings as trace events, the tasks keep recording meanwhile
+    void Timeline::collect(bool since_dump, std::vector<std::string>& events)
+    {
+        std::lock_guard<std::mutex> lock(dump_guard);
+
+        if (!rings)
+        {
+            return;
+        }
+
+        size_t tasks = std::min(task_count.load(), MAX_TASKS);
+        std::vector<Event> copied;
+        copied.reserve(RING_SIZE);
+
+        for (size_t track = 0; track < tasks; track++)
+        {
+            Ring& ring = rings[track];
+            const char* task_name = task_names[track].load();
+            char line[128];
+            std::snprintf(line, sizeof(line),
+                          "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                          static_cast<unsigned>(track + 1), task_name != nullptr ? task_name : "task");
+            events.emplace_back(line);
+
+            uint32_t head = ring.head.load(std::memory_order_acquire);
+            uint32_t from = since_dump ? ring.dumped : 0;
+            uint32_t first = std::max(from, head - std::min<uint32_t>(head, RING_SIZE));
+
+            if (since_dump)
+            {
+                ring.dumped = head;
+            }
+
+            copied.clear();
+
+            for (uint32_t i = first; i < head; i++)
+            {
+                copied.push_back(ring.events[i % RING_SIZE]);
+            }
+
+            // the events the task overwrote while they were copied are dropped
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint32_t claimed = ring.claimed.load(std::memory_order_relaxed);
+            uint32_t valid = claimed - std::min<uint32_t>(claimed, RING_SIZE);
+
+            // without the events before, the ends of the slices they began are left out
+            uint32_t start = std::max(first, valid);
+            bool truncated = start > from;
+            int depth = 0;
+
+            for (uint32_t i = start; i < head; i++)
+            {
+                const Event& event = copied[i - first];
+                depth += event.phase == 'B' ? 1 : (event.phase == 'E' ? -1 : 0);
+
+                if (depth < 0 && truncated)
+                {
+                    depth = 0;
+                    continue;
+                }
+
+                events.push_back(format(event, track + 1));
+            }
+        }
+    }
+
+    // Format an event as a trace event of the Chrome trace event format
+    std::string Timeline::format(const Event& event, size_t track)
+    {
+        char extra[32] = "";
+
+        if (event.phase == 'i')
+        {
+            std::snprintf(extra, sizeof(extra), ",\"s\":\"t\"");
+        }
+        else if (event.phase == 's')
+        {
+            std::snprintf(extra, sizeof(extra), ",\"id\":%u", static_cast<unsigned>(event.sequence));
+        }
+        else if (event.phase == 'f')
+        {
+            std::snprintf(extra, sizeof(extra), ",\"id\":%u,\"bp\":\"e\"", static_cast<unsigned>(event.sequence));
+        }
+
+        char line[192];
+        std::snprintf(line, sizeof(line),
+                      "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%lld,\"pid\":1,\"tid\":%u%s,\"args\":{\"seq\":%u}}",
+                      event.name, KIND_NAMES[static_cast<uint8_t>(event.kind)], event.phase,
+                      static_cast<long long>(event.time_us), static_cast<unsigned>(track), extra,
+                      static_cast<unsigned>(event.sequence));
+
+        return std::string(line);
+    }
+}
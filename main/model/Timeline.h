@@ -0,0 +1,212 @@
+/****************************************************************************************
+ * Timeline.h - Records timestamped events of the tasks for the Chrome trace viewer
+ *
+ * Created on Oct. 17, 2026
+ * Copyright (c) 2019 Ed Nelson (https://github.com/enelson1001)
+ * Licensed under MIT License (see LICENSE file)
+ *
+ * Derivative Works
+ * Smooth - A C++ framework for embedded programming on top of Espressif's ESP-IDF
+ * Copyright 2019 Per Malmberg (https://gitbub.com/PerMalmberg)
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ *
+ * LittlevGL - A powerful and easy-to-use embedded GUI
+ * Copyright (c) 2016 Gábor Kiss-Vámosi (https://github.com/littlevgl/lvgl)
+ * Licensed under MIT License
+ ***************************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//  Follows a SensorFrame from the I2C reads to the pixels on the display.  Each task that
+//  records events gets its own ring of the last RING_SIZE events, written only by that
+//  task, so recording takes no lock: the event is stored and the head of the ring moved
+//  on.  A ring is read by any task, an event overwritten while it was copied is left out.
+//
+//      read        an I2C transaction of the bus queues, named after the transaction
+//      publish     the SensorTask publishing a frame, with an arrow to every delivery
+//      deliver     a mailbox giving the frame to its content pane
+//      label       a content pane setting its labels
+//      render      lv_task_handler(), LittlevGL drawing the invalidated areas
+//      flush       a flush of the display driver, with the wait for the DMA in flight
+//      display     the last transfer of a refresh is done, the frame is on the display
+//
+//  Nothing is recorded until start() allocates the rings.  dump() logs the events
+//  recorded since the last dump as "TIMELINE <event>" lines of the Chrome trace event
+//  format, which host/tools/TimelineFromLog turns into a file for chrome://tracing or
+//  ui.perfetto.dev.  The host build writes the same file with --timeline.
+/////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace redstone
+{
+    /// The category of a timeline event
+    enum class TimelineKind : uint8_t
+    {
+        Read,
+        Publish,
+        Deliver,
+        Label,
+        Render,
+        Flush,
+        Display
+    };
+
+    class Timeline
+    {
+        public:
+            /// The number of tasks that can record and the events kept for each
+            static constexpr size_t MAX_TASKS = 4;
+            static constexpr size_t RING_SIZE = 256;
+
+            /// Get the timeline
+            static Timeline& instance();
+
+            /// Allocate the rings and start recording
+            void start();
+
+            /// Is the timeline recording
+            /// \param return Return true once started
+            bool is_recording() const
+            {
+                return recording.load(std::memory_order_acquire);
+            }
+
+            /// Name the track of the calling task
+            /// \param name The name of the task, a string literal
+            void name_task(const char* name);
+
+            /// The calling task began something
+            /// \param kind The category
+            /// \param name The name, a string literal
+            /// \param sequence The sequence number of the frame or 0
+            void begin(TimelineKind kind, const char* name, uint32_t sequence = 0)
+            {
+                record(kind, name, sequence, 'B');
+            }
+
+            /// The calling task ended the last thing it began
+            /// \param kind The category
+            /// \param name The name, a string literal
+            /// \param sequence The sequence number of the frame or 0
+            void end(TimelineKind kind, const char* name, uint32_t sequence = 0)
+            {
+                record(kind, name, sequence, 'E');
+            }
+
+            /// Something happened on the calling task
+            /// \param kind The category
+            /// \param name The name, a string literal
+            /// \param sequence The sequence number of the frame or 0
+            void instant(TimelineKind kind, const char* name, uint32_t sequence = 0)
+            {
+                record(kind, name, sequence, 'i');
+            }
+
+            /// A frame leaves the calling task, inside the slice that publishes it
+            /// \param sequence The sequence number of the frame
+            void frame_sent(uint32_t sequence)
+            {
+                record(TimelineKind::Publish, "frame", sequence, 's');
+            }
+
+            /// A frame arrives on the calling task, inside the slice that delivers it
+            /// \param sequence The sequence number of the frame
+            void frame_received(uint32_t sequence)
+            {
+                record(TimelineKind::Publish, "frame", sequence, 'f');
+            }
+
+            /// Log the events recorded since the last dump as TIMELINE lines
+            void dump();
+
+            /// Write every event still in the rings as a Chrome trace file
+            /// \param out The stream of the file
+            void write(std::ostream& out);
+
+            /// Write trace events as a Chrome trace file
+            /// \param events The trace events, one JSON object each
+            /// \param out The stream of the file
+            static void write_document(const std::vector<std::string>& events, std::ostream& out);
+
+        private:
+            /// Constructor
+            Timeline() = default;
+
+            struct Event
+            {
+                int64_t time_us;
+                const char* name;
+                uint32_t sequence;
+                TimelineKind kind;
+                char phase;
+            };
+
+            struct Ring
+            {
+                std::array<Event, RING_SIZE> events;
+                std::atomic<uint32_t> claimed{ 0 }; // the number of events written or being written
+                std::atomic<uint32_t> head{ 0 };    // the number of events written
+                uint32_t dumped{ 0 };               // the number of events dumped
+            };
+
+            /// Record an event of the calling task
+            void record(TimelineKind kind, const char* name, uint32_t sequence, char phase);
+
+            /// Get the ring of the calling task
+            /// \param return Return the index of its ring, MAX_TASKS when all are taken
+            size_t get_task_ring();
+
+            /// Copy the events of the rings as trace events
+            /// \param since_dump Only the events recorded since the last dump
+            /// \param events The trace events
+            void collect(bool since_dump, std::vector<std::string>& events);
+
+            /// Format an event as a trace event
+            static std::string format(const Event& event, size_t track);
+
+            std::atomic<bool> recording{ false };
+            std::unique_ptr<Ring[]> rings{};
+            std::atomic<size_t> task_count{ 0 };
+            std::array<std::atomic<const char*>, MAX_TASKS> task_names{};
+            std::atomic<uint32_t> lost{ 0 };
+            std::mutex dump_guard{};
+    };
+
+    /// Records the begin and the end of a scope
+    class TimelineScope
+    {
+        public:
+            /// Constructor
+            /// \param kind The category
+            /// \param name The name, a string literal
+            /// \param sequence The sequence number of the frame or 0
+            TimelineScope(TimelineKind kind, const char* name, uint32_t sequence = 0) :
+                    kind(kind), name(name), sequence(sequence)
+            {
+                Timeline::instance().begin(kind, name, sequence);
+            }
+
+            /// Destructor
+            ~TimelineScope()
+            {
+                Timeline::instance().end(kind, name, sequence);
+            }
+
+            TimelineScope(const TimelineScope&) = delete;
+            TimelineScope& operator=(const TimelineScope&) = delete;
+
+        private:
+            TimelineKind kind;
+            const char* name;
+            uint32_t sequence;
+    };
+}